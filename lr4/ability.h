@@ -1,9 +1,11 @@
 #ifndef ABILITY_H
 #define ABILITY_H
 
+#include <cstdint>
+
 #include "game_field.h"
 
-enum class AbilityType {
+enum class AbilityType : uint8_t {
     DoubleDamage,
     Scanner,
     Barrage
@@ -12,7 +14,6 @@ enum class AbilityType {
 class Ability {
 public:
     virtual void apply(GameField& field) = 0;
-    virtual void setParameters() {};
     virtual AbilityType getType() const = 0;
     virtual ~Ability() = default;
 };
@@ -0,0 +1,152 @@
+#include "ability_advisor.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "scanner_ability.h"
+
+namespace
+{
+double binaryEntropy(double p)
+{
+    if (p <= 0.0 || p >= 1.0)
+        return 0.0;
+    return -p * std::log2(p) - (1.0 - p) * std::log2(1.0 - p);
+}
+}
+
+double AbilityEstimate::score() const
+{
+    return expectedHits + AbilityAdvisor::INFORMATION_WEIGHT * expectedInformation;
+}
+
+AbilityAdvisor::AbilityAdvisor(const GameRng& rng, int targetSamples, int maxAttempts)
+    : rng(rng), targetSamples(targetSamples), maxAttempts(maxAttempts)
+{
+}
+
+AbilityAdvice AbilityAdvisor::advise(const KnowledgeBoard& knowledge, const FleetDescriptor& fleet,
+                                     const AbilityManager& abilities)
+{
+    prepare(knowledge, fleet);
+
+    AbilityAdvice advice;
+    while (samples < targetSamples && advice.attempts < maxAttempts)
+    {
+        ++advice.attempts;
+        if (sampler.sample(rng))
+            accumulateSample();
+    }
+    advice.samples = samples;
+    summarize(advice);
+
+    advice.hasNext = abilities.hasAbilities();
+    if (advice.hasNext)
+    {
+        advice.next = abilities.peekAbility();
+        advice.useNow = samples > 0 && advice.estimateFor(advice.next).score() >= USE_THRESHOLD;
+    }
+    return advice;
+}
+
+void AbilityAdvisor::prepare(const KnowledgeBoard& knowledge, const FleetDescriptor& fleet)
+{
+    sampler.prepare(knowledge, fleet);
+    occupancy.assign(sampler.getCellCount(), 0);
+    samples = 0;
+    liveSegmentsNew = 0.0;
+    sinkingSegments = 0.0;
+}
+
+void AbilityAdvisor::accumulateSample()
+{
+    ++samples;
+
+    const std::vector<FleetSampler::Placement>& chosen = sampler.getChosen();
+    int live = 0;
+    int revealing = 0;
+    int sinking = 0;
+    for (size_t ship = 0; ship < chosen.size(); ++ship)
+    {
+        int length = sampler.getRemainingLengths()[ship];
+        int shipLive = 0;
+        bool lastDamaged = false;
+        for (int k = 0; k < length; ++k)
+        {
+            int index = chosen[ship].index + k * chosen[ship].step;
+            ++occupancy[index];
+            Knowledge cell = sampler.cellAt(index);
+            if (cell == Knowledge::Destroyed)
+                continue;
+
+            ++shipLive;
+            lastDamaged = cell == Knowledge::Damaged;
+            if (cell == Knowledge::Unknown)
+                ++revealing;
+        }
+        live += shipLive;
+        if (shipLive == 1 && lastDamaged)
+            ++sinking;
+    }
+
+    if (live > 0)
+    {
+        liveSegmentsNew += static_cast<double>(revealing) / live;
+        sinkingSegments += static_cast<double>(sinking) / live;
+    }
+}
+
+void AbilityAdvisor::summarize(AbilityAdvice& advice) const
+{
+    for (size_t type = 0; type < advice.estimates.size(); ++type)
+        advice.estimates[type].type = static_cast<AbilityType>(type);
+
+    if (samples == 0)
+        return;
+
+    int width = sampler.getWidth();
+    int height = sampler.getHeight();
+    auto probability = [&](size_t index) { return static_cast<double>(occupancy[index]) / samples; };
+
+    AbilityEstimate& doubleDamage = advice.estimates[static_cast<size_t>(AbilityType::DoubleDamage)];
+    for (size_t index = 0; index < sampler.getCellCount(); ++index)
+    {
+        if (sampler.cellAt(index) != Knowledge::Unknown && sampler.cellAt(index) != Knowledge::Ship)
+            continue;
+        if (probability(index) > doubleDamage.expectedHits)
+        {
+            doubleDamage.expectedHits = probability(index);
+            doubleDamage.targetX = static_cast<int>(index % width);
+            doubleDamage.targetY = static_cast<int>(index / width);
+        }
+    }
+
+    AbilityEstimate& scanner = advice.estimates[static_cast<size_t>(AbilityType::Scanner)];
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            double information = 0.0;
+            for (int dy = 0; dy < ScannerAbility::AREA_SIZE && y + dy < height; ++dy)
+            {
+                for (int dx = 0; dx < ScannerAbility::AREA_SIZE && x + dx < width; ++dx)
+                {
+                    size_t index = static_cast<size_t>(y + dy) * width + x + dx;
+                    if (sampler.cellAt(index) == Knowledge::Unknown)
+                        information += binaryEntropy(probability(index));
+                }
+            }
+            if (information > scanner.expectedInformation)
+            {
+                scanner.expectedInformation = information;
+                scanner.targetX = x;
+                scanner.targetY = y;
+            }
+        }
+    }
+
+    AbilityEstimate& barrage = advice.estimates[static_cast<size_t>(AbilityType::Barrage)];
+    barrage.expectedHits = sampler.getRemainingLengths().empty() ? 0.0 : 1.0;
+    barrage.expectedInformation = liveSegmentsNew / samples;
+    barrage.sinkChance = sinkingSegments / samples;
+}
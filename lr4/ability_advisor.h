@@ -0,0 +1,69 @@
+#ifndef ABILITY_ADVISOR_H
+#define ABILITY_ADVISOR_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "ability_manager.h"
+#include "fleet_descriptor.h"
+#include "fleet_sampler.h"
+#include "game_rng.h"
+#include "knowledge_board.h"
+
+struct AbilityEstimate
+{
+    AbilityType type = AbilityType::DoubleDamage;
+    double expectedHits = 0.0;
+    double expectedInformation = 0.0;
+    double sinkChance = 0.0;
+    int targetX = -1;
+    int targetY = -1;
+
+    double score() const;
+};
+
+struct AbilityAdvice
+{
+    int samples = 0;
+    int attempts = 0;
+    std::array<AbilityEstimate, AbilityManager::TYPE_COUNT> estimates {};
+    bool hasNext = false;
+    AbilityType next = AbilityType::DoubleDamage;
+    bool useNow = false;
+
+    const AbilityEstimate& estimateFor(AbilityType type) const { return estimates[static_cast<size_t>(type)]; }
+};
+
+class AbilityAdvisor
+{
+public:
+    static constexpr int DEFAULT_SAMPLES = 256;
+    static constexpr int DEFAULT_ATTEMPTS = 8192;
+    static constexpr double INFORMATION_WEIGHT = 0.5;
+    static constexpr double USE_THRESHOLD = 0.5;
+
+    explicit AbilityAdvisor(const GameRng& rng = GameRng(), int targetSamples = DEFAULT_SAMPLES,
+                            int maxAttempts = DEFAULT_ATTEMPTS);
+
+    AbilityAdvice advise(const KnowledgeBoard& knowledge, const FleetDescriptor& fleet,
+                         const AbilityManager& abilities);
+
+private:
+    void prepare(const KnowledgeBoard& knowledge, const FleetDescriptor& fleet);
+    void accumulateSample();
+    void summarize(AbilityAdvice& advice) const;
+
+    GameRng rng;
+    int targetSamples;
+    int maxAttempts;
+
+    FleetSampler sampler;
+
+    int samples = 0;
+    std::vector<uint32_t> occupancy;
+    double liveSegmentsNew = 0.0;
+    double sinkingSegments = 0.0;
+};
+
+#endif
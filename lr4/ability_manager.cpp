@@ -4,87 +4,86 @@
 #include "double_damage_ability.h"
 #include "scanner_ability.h"
 #include "exceptions.h"
-#include <random>
+#include <stdexcept>
 
-AbilityManager::AbilityManager()
+AbilityManager::AbilityManager(const GameRng& rng) : rng(rng)
 {
     addRandomAbility();
 }
 
-void AbilityManager::addAbility(std::unique_ptr<Ability> ability)
+bool AbilityManager::addAbility(AbilityType type)
 {
-    abilities.push_back(std::move(ability));
+    if (count == CAPACITY)
+        return false;
+
+    queue[(head + count) % CAPACITY] = type;
+    ++count;
+    return true;
 }
 
-void AbilityManager::useAbility(GameField& field)
+AbilityResult AbilityManager::useAbility(GameField& field, const ScanRegion& scanRegion)
 {
-    if (abilities.empty())
+    if (count == 0)
         throw AbilityUnavailableException();
 
-    std::unique_ptr<Ability> ability = std::move(abilities.front());
-    abilities.pop_front();
+    AbilityType type = queue[head];
+    head = (head + 1) % CAPACITY;
+    --count;
 
-    ability->setParameters();
-    ability->apply(field);
+    AbilityResult result {type, ScanResult()};
+    switch (type) {
+        case AbilityType::DoubleDamage: {
+            DoubleDamageAbility ability;
+            ability.apply(field);
+            break;
+        }
+        case AbilityType::Scanner: {
+            ScannerAbility ability(scanRegion);
+            ability.apply(field);
+            result.scan = ability.getResult();
+            break;
+        }
+        case AbilityType::Barrage: {
+            BarrageAbility ability(rng);
+            ability.apply(field);
+            break;
+        }
+    }
+    return result;
 }
 
 bool AbilityManager::hasAbilities() const
 {
-    return !abilities.empty();
+    return count > 0;
 }
 
-void AbilityManager::addRandomAbility() {
-    std::mt19937 rng(std::random_device{}());
-    std::uniform_int_distribution<int> abilityDist(0, 2);
-    int abilityIndex = abilityDist(rng);
+AbilityType AbilityManager::peekAbility() const
+{
+    if (count == 0)
+        throw AbilityUnavailableException();
+    return queue[head];
+}
 
-    switch (abilityIndex) {
-        case 0:
-            addAbility(std::make_unique<DoubleDamageAbility>());
-            break;
-        case 1:
-            addAbility(std::make_unique<ScannerAbility>());
-            break;
-        case 2:
-            addAbility(std::make_unique<BarrageAbility>());
-            break;
-    }
+ScanRegion AbilityManager::defaultScanRegion()
+{
+    return ScanRegion::rectangle(0, 0, ScannerAbility::AREA_SIZE, ScannerAbility::AREA_SIZE);
 }
 
-std::vector<int> AbilityManager::getAbilityCounts() const {
-    std::vector<int> counts(3, 0);
-    
-    for (const auto& ability : abilities) {
-        switch (ability->getType()) {
-            case AbilityType::DoubleDamage:
-                ++counts[0];
-                break;
-            case AbilityType::Scanner:
-                ++counts[1];
-                break;
-            case AbilityType::Barrage:
-                ++counts[2];
-                break;
-        }
-    }
-    
-    return counts;
+AbilityType AbilityManager::at(size_t position) const
+{
+    if (position >= count)
+        throw std::out_of_range("Ability position out of range.");
+    return queue[(head + position) % CAPACITY];
 }
 
-void AbilityManager::setAbilitiesFromCounts(const std::vector<int>& counts) {
-    abilities.clear();
-    
-    if (counts.size() >= 3) {
-        for (int i = 0; i < counts[0]; ++i) {
-            addAbility(std::make_unique<DoubleDamageAbility>());
-        }
-        for (int i = 0; i < counts[1]; ++i) {
-            addAbility(std::make_unique<ScannerAbility>());
-        }
-        for (int i = 0; i < counts[2]; ++i) {
-            addAbility(std::make_unique<BarrageAbility>());
-        }
-    }
+void AbilityManager::clear()
+{
+    head = 0;
+    count = 0;
+}
+
+void AbilityManager::addRandomAbility() {
+    addAbility(static_cast<AbilityType>(rng.below(static_cast<uint32_t>(TYPE_COUNT))));
 }
 
 std::string AbilityManager::abilityTypeToString(AbilityType type) {
@@ -101,8 +100,8 @@ std::string AbilityManager::abilityTypeToString(AbilityType type) {
 }
 
 std::string AbilityManager::getFirstAbilityName() const {
-    if (abilities.empty()) {
+    if (count == 0) {
         return "нет доступных";
     }
-    return abilityTypeToString(abilities.front()->getType());
-}
\ No newline at end of file
+    return abilityTypeToString(queue[head]);
+}
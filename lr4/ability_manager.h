@@ -1,30 +1,47 @@
 #ifndef ABILITY_MANAGER_H
 #define ABILITY_MANAGER_H
 
-#include <memory>
-#include <deque>
-#include <vector>
+#include <array>
+#include <cstddef>
+#include <string>
 #include "ability.h"
+#include "game_rng.h"
 
 class GameField;
 
+struct AbilityResult {
+    AbilityType type;
+    ScanResult scan;
+};
+
 class AbilityManager {
 public:
-    AbilityManager();
-    void addAbility(std::unique_ptr<Ability> ability);
-    void useAbility(GameField& field);
+    static constexpr size_t CAPACITY = 256;
+    static constexpr size_t TYPE_COUNT = 3;
+
+    using Counts = std::array<int, TYPE_COUNT>;
+
+    explicit AbilityManager(const GameRng& rng = GameRng());
+    bool addAbility(AbilityType type);
+    AbilityResult useAbility(GameField& field, const ScanRegion& scanRegion = defaultScanRegion());
     bool hasAbilities() const;
+    AbilityType peekAbility() const;
     void addRandomAbility();
 
-    std::vector<int> getAbilityCounts() const;
-    void setAbilitiesFromCounts(const std::vector<int>& counts);
+    size_t size() const { return count; }
+    AbilityType at(size_t position) const;
+    void clear();
 
     std::string getFirstAbilityName() const;
+    static std::string abilityTypeToString(AbilityType type);
 
 private:
-    std::deque<std::unique_ptr<Ability>> abilities;
+    GameRng rng;
+    std::array<AbilityType, CAPACITY> queue;
+    size_t head = 0;
+    size_t count = 0;
 
-    static std::string abilityTypeToString(AbilityType type);
+    static ScanRegion defaultScanRegion();
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -2,11 +2,16 @@
 #define BARRAGE_ABILITY_H
 
 #include "ability.h"
+#include "game_rng.h"
 
 class BarrageAbility : public Ability {
 public:
+    explicit BarrageAbility(GameRng& rng) : rng(rng) {}
+
     void apply(GameField& field) override;
     AbilityType getType() const override { return AbilityType::Barrage; }
+private:
+    GameRng& rng;
 };
 
 #endif
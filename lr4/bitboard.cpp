@@ -0,0 +1,18 @@
+#include "bitboard.h"
+
+Bitboard::Bitboard(size_t bits, std::pmr::memory_resource* resource)
+    : BasicBitboard(std::pmr::vector<uint64_t>(resource)), bits(bits)
+{
+    words.assign((bits + 63) / 64, 0);
+}
+
+Bitboard::Bitboard(const Bitboard& other, std::pmr::memory_resource* resource)
+    : BasicBitboard(std::pmr::vector<uint64_t>(other.words, resource)), bits(other.bits)
+{
+}
+
+void Bitboard::resize(size_t newBits)
+{
+    words.assign((newBits + 63) / 64, 0);
+    bits = newBits;
+}
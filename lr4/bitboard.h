@@ -0,0 +1,179 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+constexpr uint64_t bitRangeMask(size_t begin, size_t end)
+{
+    uint64_t high = (end == 64) ? ~uint64_t(0) : ((uint64_t(1) << end) - 1);
+    uint64_t low = (uint64_t(1) << begin) - 1;
+    return high & ~low;
+}
+
+template<typename Words>
+class BasicBitboard
+{
+public:
+    bool test(size_t index) const { return (words[index >> 6] >> (index & 63)) & 1u; }
+    void set(size_t index) { words[index >> 6] |= uint64_t(1) << (index & 63); }
+    void reset(size_t index) { words[index >> 6] &= ~(uint64_t(1) << (index & 63)); }
+    uint64_t wordAt(size_t word) const { return words[word]; }
+    void setBitsInWord(size_t word, uint64_t bits) { words[word] |= bits; }
+
+    void clear()
+    {
+        for (auto& word : words)
+            word = 0;
+    }
+
+    bool anyInRange(size_t begin, size_t end) const
+    {
+        if (begin >= end)
+            return false;
+
+        size_t firstWord = begin >> 6;
+        size_t lastWord = (end - 1) >> 6;
+
+        if (firstWord == lastWord)
+            return (words[firstWord] & bitRangeMask(begin & 63, ((end - 1) & 63) + 1)) != 0;
+
+        if (words[firstWord] & bitRangeMask(begin & 63, 64))
+            return true;
+        for (size_t w = firstWord + 1; w < lastWord; ++w)
+        {
+            if (words[w])
+                return true;
+        }
+        return (words[lastWord] & bitRangeMask(0, ((end - 1) & 63) + 1)) != 0;
+    }
+
+    void setRange(size_t begin, size_t end)
+    {
+        if (begin >= end)
+            return;
+
+        size_t firstWord = begin >> 6;
+        size_t lastWord = (end - 1) >> 6;
+
+        if (firstWord == lastWord)
+        {
+            words[firstWord] |= bitRangeMask(begin & 63, ((end - 1) & 63) + 1);
+            return;
+        }
+
+        words[firstWord] |= bitRangeMask(begin & 63, 64);
+        for (size_t w = firstWord + 1; w < lastWord; ++w)
+            words[w] = ~uint64_t(0);
+        words[lastWord] |= bitRangeMask(0, ((end - 1) & 63) + 1);
+    }
+
+    template<typename Visitor>
+    void forEachWordInRange(size_t begin, size_t end, Visitor visitor) const
+    {
+        if (begin >= end)
+            return;
+
+        size_t firstWord = begin >> 6;
+        size_t lastWord = (end - 1) >> 6;
+        for (size_t w = firstWord; w <= lastWord; ++w)
+        {
+            size_t low = (w == firstWord) ? begin & 63 : 0;
+            size_t high = (w == lastWord) ? ((end - 1) & 63) + 1 : 64;
+            visitor(w * 64, words[w] & bitRangeMask(low, high));
+        }
+    }
+
+    size_t countInRange(size_t begin, size_t end) const
+    {
+        size_t total = 0;
+        forEachWordInRange(begin, end, [&](size_t, uint64_t word) {
+            total += static_cast<size_t>(__builtin_popcountll(word));
+        });
+        return total;
+    }
+
+    template<typename Mask>
+    bool intersects(const Mask& mask) const
+    {
+        uint64_t common = 0;
+        for (size_t w = 0; w < mask.size(); ++w)
+            common |= words[w] & mask[w];
+        return common != 0;
+    }
+
+    template<typename Mask>
+    void setMask(const Mask& mask)
+    {
+        for (size_t w = 0; w < mask.size(); ++w)
+            words[w] |= mask[w];
+    }
+
+    template<typename Mask>
+    void clearMask(const Mask& mask)
+    {
+        for (size_t w = 0; w < mask.size(); ++w)
+            words[w] &= ~mask[w];
+    }
+
+    template<typename Mask>
+    void keepMask(const Mask& mask)
+    {
+        for (size_t w = 0; w < mask.size(); ++w)
+            words[w] &= mask[w];
+    }
+
+    template<typename Visitor>
+    void forEachSetBit(Visitor visitor) const
+    {
+        for (size_t w = 0; w < words.size(); ++w)
+        {
+            for (uint64_t word = words[w]; word; word &= word - 1)
+                visitor(w * 64 + static_cast<size_t>(__builtin_ctzll(word)));
+        }
+    }
+
+    size_t count() const
+    {
+        size_t total = 0;
+        for (uint64_t word : words)
+            total += static_cast<size_t>(__builtin_popcountll(word));
+        return total;
+    }
+
+    const Words& data() const { return words; }
+
+protected:
+    BasicBitboard() = default;
+    explicit BasicBitboard(Words initial) : words(std::move(initial)) {}
+
+    Words words {};
+};
+
+class Bitboard : public BasicBitboard<std::pmr::vector<uint64_t>>
+{
+public:
+    explicit Bitboard(size_t bits = 0, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    Bitboard(const Bitboard& other, std::pmr::memory_resource* resource);
+
+    size_t size() const { return bits; }
+    void resize(size_t newBits);
+
+private:
+    size_t bits;
+};
+
+template<size_t Bits>
+class FixedBitboard : public BasicBitboard<std::array<uint64_t, (Bits + 63) / 64>>
+{
+public:
+    static constexpr size_t WORDS = (Bits + 63) / 64;
+
+    constexpr size_t size() const { return Bits; }
+};
+
+#endif
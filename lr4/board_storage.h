@@ -0,0 +1,130 @@
+#ifndef BOARD_STORAGE_H
+#define BOARD_STORAGE_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "bitboard.h"
+#include "ship.h"
+#include "sparse_bitset.h"
+
+struct PlacedShip
+{
+    Ship* ship;
+    int x;
+    int y;
+    Orientation orientation;
+};
+
+template<typename Bits, typename ShipIds>
+struct BoardCells
+{
+    Bits occupied;
+    Bits hit;
+    Bits miss;
+    Bits destroyed;
+    Bits blocked;
+    ShipIds shipIds;
+};
+
+template<int W, int H>
+class FixedBoard
+{
+public:
+    static constexpr int WIDTH = W;
+    static constexpr int HEIGHT = H;
+    static constexpr int CELLS = W * H;
+    static constexpr int MAX_SHIPS = ((W + 1) / 2) * ((H + 1) / 2);
+
+    using Cells = BoardCells<FixedBitboard<CELLS>, std::array<int16_t, CELLS>>;
+
+    FixedBoard() { data.shipIds.fill(-1); }
+
+    constexpr int width() const { return W; }
+    constexpr int height() const { return H; }
+
+    const Cells& cells() const { return data; }
+    Cells& mutableCells() { return data; }
+
+    int shipCount() const { return placedCount; }
+    const PlacedShip& ship(int id) const { return ships[id]; }
+    int addShip(const PlacedShip& placed)
+    {
+        if (placedCount == MAX_SHIPS)
+            return -1;
+        ships[placedCount] = placed;
+        return placedCount++;
+    }
+
+    template<typename Remap>
+    void remapShips(Remap remap)
+    {
+        for (int i = 0; i < placedCount; ++i)
+            ships[i].ship = remap(ships[i].ship);
+    }
+
+private:
+    Cells data;
+    std::array<PlacedShip, MAX_SHIPS> ships {};
+    int placedCount = 0;
+};
+
+using StandardBoard = FixedBoard<10, 10>;
+
+template<typename CellStorage>
+class HeapBoard
+{
+public:
+    using Cells = CellStorage;
+
+    HeapBoard(int width, int height)
+        : boardWidth(width), boardHeight(height), data(std::make_shared<Cells>())
+    {
+        size_t cellCount = static_cast<size_t>(width) * height;
+        data->occupied.resize(cellCount);
+        data->hit.resize(cellCount);
+        data->miss.resize(cellCount);
+        data->destroyed.resize(cellCount);
+        data->blocked.resize(cellCount);
+        data->shipIds.assign(cellCount, -1);
+    }
+
+    int width() const { return boardWidth; }
+    int height() const { return boardHeight; }
+
+    const Cells& cells() const { return *data; }
+    Cells& mutableCells()
+    {
+        if (data.use_count() > 1)
+            data = std::make_shared<Cells>(*data);
+        return *data;
+    }
+
+    int shipCount() const { return static_cast<int>(ships.size()); }
+    const PlacedShip& ship(int id) const { return ships[id]; }
+    int addShip(const PlacedShip& placed)
+    {
+        ships.push_back(placed);
+        return static_cast<int>(ships.size()) - 1;
+    }
+
+    template<typename Remap>
+    void remapShips(Remap remap)
+    {
+        for (auto& placed : ships)
+            placed.ship = remap(placed.ship);
+    }
+
+private:
+    int boardWidth;
+    int boardHeight;
+    std::shared_ptr<Cells> data;
+    std::vector<PlacedShip> ships;
+};
+
+using DynamicBoard = HeapBoard<BoardCells<Bitboard, std::vector<int>>>;
+using SparseBoard = HeapBoard<BoardCells<SparseBitset, SparseShipIds>>;
+
+#endif
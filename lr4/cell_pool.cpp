@@ -0,0 +1,38 @@
+#include "cell_pool.h"
+
+#include <stdexcept>
+#include <utility>
+
+void CellPool::reset(size_t cellCount)
+{
+    if (cellCount >= ABSENT)
+        throw std::length_error("Cell pool is too large.");
+
+    cells.clear();
+    cells.reserve(cellCount);
+    positions.assign(cellCount, ABSENT);
+}
+
+void CellPool::insert(size_t cell)
+{
+    if (cell >= positions.size())
+        throw std::out_of_range("Cell index out of range.");
+    if (positions[cell] != ABSENT)
+        return;
+
+    positions[cell] = static_cast<uint32_t>(cells.size());
+    cells.push_back(static_cast<uint32_t>(cell));
+}
+
+void CellPool::remove(size_t cell)
+{
+    if (!contains(cell))
+        return;
+
+    uint32_t position = positions[cell];
+    uint32_t last = cells.back();
+    cells[position] = last;
+    positions[last] = position;
+    cells.pop_back();
+    positions[cell] = ABSENT;
+}
@@ -0,0 +1,83 @@
+#ifndef CELL_POOL_H
+#define CELL_POOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "game_rng.h"
+
+class CellPool
+{
+public:
+    void reset(size_t cellCount);
+
+    void insert(size_t cell);
+    void remove(size_t cell);
+    bool contains(size_t cell) const { return cell < positions.size() && positions[cell] != ABSENT; }
+
+    bool empty() const { return cells.empty(); }
+    size_t size() const { return cells.size(); }
+    size_t at(size_t position) const { return cells[position]; }
+
+    template<typename Score>
+    size_t pickBest(GameRng& rng, Score score) const
+    {
+        size_t best = cells[0];
+        auto bestScore = score(best);
+        uint32_t ties = 1;
+
+        for (size_t position = 1; position < cells.size(); ++position)
+        {
+            auto value = score(cells[position]);
+            if (value > bestScore)
+            {
+                best = cells[position];
+                bestScore = value;
+                ties = 1;
+            }
+            else if (value == bestScore && rng.below(++ties) == 0)
+            {
+                best = cells[position];
+            }
+        }
+        return best;
+    }
+
+    template<typename Score>
+    std::vector<size_t> pickTop(size_t count, GameRng& rng, Score score) const
+    {
+        using Value = decltype(score(size_t()));
+        struct Ranked
+        {
+            Value score;
+            uint64_t tieBreak;
+            size_t cell;
+        };
+
+        std::vector<Ranked> ranked;
+        ranked.reserve(cells.size());
+        for (uint32_t cell : cells)
+            ranked.push_back({score(cell), rng(), cell});
+
+        count = std::min(count, ranked.size());
+        std::partial_sort(ranked.begin(), ranked.begin() + count, ranked.end(), [](const Ranked& a, const Ranked& b) {
+            return a.score != b.score ? a.score > b.score : a.tieBreak > b.tieBreak;
+        });
+
+        std::vector<size_t> picked;
+        picked.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            picked.push_back(ranked[i].cell);
+        return picked;
+    }
+
+private:
+    static constexpr uint32_t ABSENT = UINT32_MAX;
+
+    std::vector<uint32_t> cells;
+    std::vector<uint32_t> positions;
+};
+
+#endif
@@ -0,0 +1,280 @@
+#include "density_targeter.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+constexpr int TRANSPOSE_TILE = 32;
+
+template<typename Visitor>
+void forEachTransposed(int width, int height, Visitor visitor)
+{
+    for (int tileY = 0; tileY < height; tileY += TRANSPOSE_TILE)
+    {
+        for (int tileX = 0; tileX < width; tileX += TRANSPOSE_TILE)
+        {
+            for (int y = tileY; y < std::min(tileY + TRANSPOSE_TILE, height); ++y)
+            {
+                for (int x = tileX; x < std::min(tileX + TRANSPOSE_TILE, width); ++x)
+                    visitor(static_cast<size_t>(y) * width + x, static_cast<size_t>(x) * height + y);
+            }
+        }
+    }
+}
+}
+
+void DensityTargeter::update(const KnowledgeBoard& knowledge, const FleetDescriptor& fleet,
+                             const PlacementIndex* index)
+{
+    readKnowledge(knowledge);
+    if (index && !hasHits && canUseIndex(*index, fleet))
+    {
+        densityFromIndex(*index, fleet);
+        return;
+    }
+
+    countRemaining(fleet);
+    transposeRows();
+    prepareGrid(rows);
+    prepareGrid(columns);
+
+    size_t cellCount = static_cast<size_t>(width) * height;
+    density.assign(cellCount, 0);
+    transposedDensity.assign(cellCount, 0);
+
+    for (int length = 1; length < static_cast<int>(remaining.size()); ++length)
+    {
+        if (remaining[length] == 0)
+            continue;
+
+        accumulateColumns(rows, length, static_cast<uint64_t>(remaining[length]), density);
+        if (length > 1)
+            accumulateColumns(columns, length, static_cast<uint64_t>(remaining[length]), transposedDensity);
+    }
+
+    forEachTransposed(width, height, [&](size_t cell, size_t transposed) { density[cell] += transposedDensity[transposed]; });
+}
+
+void DensityTargeter::readKnowledge(const KnowledgeBoard& knowledge)
+{
+    width = knowledge.getWidth();
+    height = knowledge.getHeight();
+    size_t cellCount = static_cast<size_t>(width) * height;
+
+    rows.width = width;
+    rows.height = height;
+    rows.open.resize(cellCount);
+    rows.hits.resize(cellCount);
+    sure.resize(cellCount);
+    sunk.resize(cellCount);
+
+    hasHits = false;
+    cells.assign(cellCount, Knowledge::Unknown);
+    auto mark = [&](const Bitboard& bits, Knowledge knowledge)
+    {
+        bits.forEachSetBit([&](size_t index) { cells[index] = knowledge; });
+    };
+
+    mark(knowledge.getScannedEmpty(), Knowledge::Empty);
+    mark(knowledge.getScannedShips(), Knowledge::Ship);
+    mark(knowledge.getMisses(), Knowledge::Miss);
+    mark(knowledge.getDamaged(), Knowledge::Damaged);
+    mark(knowledge.getDestroyed(), Knowledge::Destroyed);
+    mark(knowledge.getSunk(), Knowledge::Sunk);
+
+    for (size_t index = 0; index < cellCount; ++index)
+    {
+        Knowledge cell = cells[index];
+        rows.open[index] = cell != Knowledge::Miss && cell != Knowledge::Empty;
+        rows.hits[index] = cell == Knowledge::Ship || cell == Knowledge::Damaged || cell == Knowledge::Destroyed;
+        sure[index] = cell == Knowledge::Ship || cell == Knowledge::Damaged;
+        sunk[index] = cell == Knowledge::Sunk;
+        hasHits = hasHits || rows.hits[index];
+    }
+
+    for (size_t index = 0; index < cellCount; ++index)
+    {
+        if (!sunk[index] && !rows.hits[index])
+            continue;
+
+        int x = static_cast<int>(index % width);
+        int y = static_cast<int>(index / width);
+        for (int ny = std::max(y - 1, 0); ny <= std::min(y + 1, height - 1); ++ny)
+        {
+            for (int nx = std::max(x - 1, 0); nx <= std::min(x + 1, width - 1); ++nx)
+            {
+                size_t neighbour = static_cast<size_t>(ny) * width + nx;
+                bool diagonal = nx != x && ny != y;
+                if (sunk[index] || (diagonal && !rows.hits[neighbour]))
+                    rows.open[neighbour] = 0;
+            }
+        }
+    }
+}
+
+bool DensityTargeter::canUseIndex(const PlacementIndex& index, const FleetDescriptor& fleet) const
+{
+    if (index.getWidth() != width || index.getHeight() != height)
+        return false;
+
+    for (const ShipClass& shipClass : fleet.getClasses())
+    {
+        if (!index.tracksLength(shipClass.length))
+            return false;
+    }
+    return true;
+}
+
+void DensityTargeter::densityFromIndex(const PlacementIndex& index, const FleetDescriptor& fleet)
+{
+    density.assign(static_cast<size_t>(width) * height, 0);
+    for (int length = 1; length <= fleet.getMaxLength(); ++length)
+    {
+        uint64_t ships = static_cast<uint64_t>(index.remainingShips(length));
+        if (ships == 0)
+            continue;
+
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+                density[static_cast<size_t>(y) * width + x] += ships * index.coverage(length, x, y);
+        }
+    }
+}
+
+void DensityTargeter::countRemaining(const FleetDescriptor& fleet)
+{
+    std::vector<int> sunkByLength(fleet.getMaxLength() + 1, 0);
+    std::vector<uint8_t> visited(sunk.size(), 0);
+    std::vector<size_t> pending;
+
+    for (size_t start = 0; start < sunk.size(); ++start)
+    {
+        if (!sunk[start] || visited[start])
+            continue;
+
+        int length = 0;
+        pending.assign(1, start);
+        visited[start] = 1;
+        while (!pending.empty())
+        {
+            size_t index = pending.back();
+            pending.pop_back();
+            ++length;
+
+            int x = static_cast<int>(index % width);
+            int y = static_cast<int>(index / width);
+            const int dx[] = {1, -1, 0, 0};
+            const int dy[] = {0, 0, 1, -1};
+            for (int k = 0; k < 4; ++k)
+            {
+                int nx = x + dx[k];
+                int ny = y + dy[k];
+                if (nx < 0 || ny < 0 || nx >= width || ny >= height)
+                    continue;
+
+                size_t neighbour = static_cast<size_t>(ny) * width + nx;
+                if (sunk[neighbour] && !visited[neighbour])
+                {
+                    visited[neighbour] = 1;
+                    pending.push_back(neighbour);
+                }
+            }
+        }
+        if (length < static_cast<int>(sunkByLength.size()))
+            ++sunkByLength[length];
+    }
+
+    remaining.assign(fleet.getMaxLength() + 1, 0);
+    for (const ShipClass& shipClass : fleet.getClasses())
+        remaining[shipClass.length] = std::max(shipClass.count - sunkByLength[shipClass.length], 0);
+}
+
+void DensityTargeter::transposeRows()
+{
+    size_t cellCount = rows.open.size();
+    columns.width = height;
+    columns.height = width;
+    columns.open.resize(cellCount);
+    columns.hits.resize(cellCount);
+
+    forEachTransposed(width, height, [&](size_t cell, size_t transposed)
+    {
+        columns.open[transposed] = rows.open[cell];
+        columns.hits[transposed] = rows.hits[cell];
+    });
+}
+
+void DensityTargeter::prepareGrid(Grid& grid)
+{
+    size_t w = static_cast<size_t>(grid.width);
+    size_t h = static_cast<size_t>(grid.height);
+    grid.run.resize((h + 1) * w);
+    grid.hitPrefix.resize((h + 1) * w);
+    std::fill(grid.run.begin() + h * w, grid.run.end(), 0);
+    std::fill(grid.hitPrefix.begin(), grid.hitPrefix.begin() + w, 0);
+
+    for (size_t y = h; y-- > 0;)
+    {
+        const uint32_t* open = &grid.open[y * w];
+        const uint32_t* below = &grid.run[(y + 1) * w];
+        uint32_t* current = &grid.run[y * w];
+        for (size_t x = 0; x < w; ++x)
+            current[x] = open[x] * (below[x] + 1);
+    }
+
+    for (size_t y = 0; y < h; ++y)
+    {
+        const uint32_t* hits = &grid.hits[y * w];
+        const uint32_t* previous = &grid.hitPrefix[y * w];
+        uint32_t* current = &grid.hitPrefix[(y + 1) * w];
+        for (size_t x = 0; x < w; ++x)
+            current[x] = previous[x] + hits[x];
+    }
+}
+
+void DensityTargeter::accumulateColumns(const Grid& grid, int length, uint64_t multiplicity,
+                                        std::vector<uint64_t>& target)
+{
+    if (length > grid.height)
+        return;
+
+    size_t w = static_cast<size_t>(grid.width);
+    size_t h = static_cast<size_t>(grid.height);
+    size_t span = static_cast<size_t>(length);
+    size_t origins = h - span + 1;
+    uint32_t minimumRun = static_cast<uint32_t>(length);
+    weightPrefix.resize((origins + 1) * w);
+    std::fill(weightPrefix.begin(), weightPrefix.begin() + w, 0);
+
+    for (size_t y = 0; y < origins; ++y)
+    {
+        const uint32_t* run = &grid.run[y * w];
+        const uint32_t* hitsBefore = &grid.hitPrefix[y * w];
+        const uint32_t* hitsAfter = &grid.hitPrefix[(y + span) * w];
+        const uint32_t* previous = &weightPrefix[y * w];
+        uint32_t* current = &weightPrefix[(y + 1) * w];
+        for (size_t x = 0; x < w; ++x)
+        {
+            uint32_t fits = run[x] >= minimumRun;
+            current[x] = previous[x] + fits * (1 + HIT_WEIGHT * (hitsAfter[x] - hitsBefore[x]));
+        }
+    }
+
+    for (size_t y = 0; y < h; ++y)
+    {
+        size_t low = y + 1 > span ? y + 1 - span : 0;
+        size_t high = std::min(y, origins - 1) + 1;
+        const uint32_t* first = &weightPrefix[low * w];
+        const uint32_t* last = &weightPrefix[high * w];
+        uint64_t* row = &target[y * w];
+        for (size_t x = 0; x < w; ++x)
+            row[x] += multiplicity * (last[x] - first[x]);
+    }
+}
+
+uint64_t DensityTargeter::score(size_t cell) const
+{
+    return sure[cell] ? std::numeric_limits<uint64_t>::max() : density[cell];
+}
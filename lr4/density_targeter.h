@@ -0,0 +1,58 @@
+#ifndef DENSITY_TARGETER_H
+#define DENSITY_TARGETER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "fleet_descriptor.h"
+#include "knowledge_board.h"
+#include "placement_index.h"
+
+class DensityTargeter
+{
+public:
+    static constexpr uint32_t HIT_WEIGHT = 32;
+
+    void update(const KnowledgeBoard& knowledge, const FleetDescriptor& fleet, const PlacementIndex* index = nullptr);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    uint64_t densityAt(size_t cell) const { return density[cell]; }
+    const std::vector<uint64_t>& getDensity() const { return density; }
+    uint64_t score(size_t cell) const;
+
+private:
+    struct Grid
+    {
+        int width = 0;
+        int height = 0;
+        std::vector<uint32_t> open;
+        std::vector<uint32_t> hits;
+        std::vector<uint32_t> run;
+        std::vector<uint32_t> hitPrefix;
+    };
+
+    void readKnowledge(const KnowledgeBoard& knowledge);
+    bool canUseIndex(const PlacementIndex& index, const FleetDescriptor& fleet) const;
+    void densityFromIndex(const PlacementIndex& index, const FleetDescriptor& fleet);
+    void countRemaining(const FleetDescriptor& fleet);
+    void transposeRows();
+    static void prepareGrid(Grid& grid);
+    void accumulateColumns(const Grid& grid, int length, uint64_t multiplicity, std::vector<uint64_t>& target);
+
+    int width = 0;
+    int height = 0;
+    Grid rows;
+    Grid columns;
+    std::vector<Knowledge> cells;
+    bool hasHits = false;
+    std::vector<uint8_t> sure;
+    std::vector<uint8_t> sunk;
+    std::vector<int> remaining;
+    std::vector<uint64_t> density;
+    std::vector<uint64_t> transposedDensity;
+    std::vector<uint32_t> weightPrefix;
+};
+
+#endif
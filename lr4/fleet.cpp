@@ -0,0 +1,81 @@
+#include "fleet.h"
+
+#include <stdexcept>
+
+Fleet::Fleet(std::pmr::memory_resource* resource)
+    : lengths(resource), originXs(resource), originYs(resource), orientations(resource),
+      damagedBits(resource), destroyedBits(resource), liveSegments(resource),
+      remainingByLength(MAX_SEGMENTS + 1, 0, resource)
+{
+}
+
+int Fleet::addShip(int length, Orientation orientation)
+{
+    if (length < 0 || length > MAX_SEGMENTS)
+        throw std::invalid_argument("Ship length out of range.");
+
+    lengths.push_back(static_cast<uint8_t>(length));
+    originXs.push_back(-1);
+    originYs.push_back(-1);
+    orientations.push_back(orientation);
+    damagedBits.push_back(0);
+    destroyedBits.push_back(0);
+    liveSegments.push_back(static_cast<uint8_t>(length));
+    if (length > 0)
+    {
+        remaining++;
+        remainingByLength[length]++;
+    }
+    return static_cast<int>(lengths.size()) - 1;
+}
+
+void Fleet::setOrigin(int ship, int x, int y)
+{
+    originXs[ship] = x;
+    originYs[ship] = y;
+}
+
+SegmentStatus Fleet::getSegmentStatus(int ship, int segment) const
+{
+    if (segment < 0 || segment >= lengths[ship])
+        throw std::out_of_range("Segment index out of range.");
+
+    uint32_t bit = uint32_t(1) << segment;
+    if (destroyedBits[ship] & bit)
+        return SegmentStatus::Destroyed;
+    if (damagedBits[ship] & bit)
+        return SegmentStatus::Damaged;
+    return SegmentStatus::Intact;
+}
+
+bool Fleet::applyDamage(int ship, int segment, int damage)
+{
+    if (segment < 0 || segment >= lengths[ship])
+        throw std::out_of_range("Segment index out of range.");
+
+    if (damage < 0)
+        throw std::invalid_argument("Damage cannot be negative.");
+
+    uint32_t bit = uint32_t(1) << segment;
+    if (destroyedBits[ship] & bit)
+        return false;
+
+    int currentDamage = static_cast<int>(getSegmentStatus(ship, segment)) + damage;
+
+    if (currentDamage >= static_cast<int>(SegmentStatus::Destroyed))
+    {
+        damagedBits[ship] |= bit;
+        destroyedBits[ship] |= bit;
+        if (--liveSegments[ship] == 0)
+        {
+            remaining--;
+            remainingByLength[lengths[ship]]--;
+            return true;
+        }
+    }
+    else if (currentDamage >= static_cast<int>(SegmentStatus::Damaged))
+    {
+        damagedBits[ship] |= bit;
+    }
+    return false;
+}
@@ -0,0 +1,46 @@
+#ifndef FLEET_H
+#define FLEET_H
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "ship.h"
+
+class Fleet
+{
+public:
+    static constexpr int MAX_SEGMENTS = 32;
+
+    explicit Fleet(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    int addShip(int length, Orientation orientation);
+
+    size_t size() const { return lengths.size(); }
+    int getLength(int ship) const { return lengths[ship]; }
+    Orientation getOrientation(int ship) const { return orientations[ship]; }
+    void setOrientation(int ship, Orientation orientation) { orientations[ship] = orientation; }
+    int getOriginX(int ship) const { return originXs[ship]; }
+    int getOriginY(int ship) const { return originYs[ship]; }
+    void setOrigin(int ship, int x, int y);
+
+    SegmentStatus getSegmentStatus(int ship, int segment) const;
+    bool applyDamage(int ship, int segment, int damage);
+    bool isSunk(int ship) const { return liveSegments[ship] == 0; }
+    int getLiveSegments(int ship) const { return liveSegments[ship]; }
+    int getShipsRemaining() const { return remaining; }
+    int getRemainingOfLength(int length) const { return remainingByLength[length]; }
+
+private:
+    std::pmr::vector<uint8_t> lengths;
+    std::pmr::vector<int> originXs;
+    std::pmr::vector<int> originYs;
+    std::pmr::vector<Orientation> orientations;
+    std::pmr::vector<uint32_t> damagedBits;
+    std::pmr::vector<uint32_t> destroyedBits;
+    std::pmr::vector<uint8_t> liveSegments;
+    std::pmr::vector<uint16_t> remainingByLength;
+    int remaining = 0;
+};
+
+#endif
@@ -0,0 +1,102 @@
+#include "fleet_descriptor.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "ship_manager.h"
+
+namespace
+{
+const std::vector<ShipClass> STANDARD_FLEET = {{4, 1}, {3, 2}, {2, 3}, {1, 4}};
+}
+
+FleetDescriptor::FleetDescriptor() : FleetDescriptor(STANDARD_FLEET)
+{
+}
+
+FleetDescriptor::FleetDescriptor(const std::vector<ShipClass>& shipClasses)
+{
+    std::vector<int> countByLength(ShipManager::MAX_LENGTH + 1, 0);
+    int shipCount = 0;
+
+    for (const ShipClass& shipClass : shipClasses)
+    {
+        if (shipClass.length < ShipManager::MIN_LENGTH || shipClass.length > ShipManager::MAX_LENGTH ||
+            shipClass.count <= 0 || shipClass.count > MAX_SHIPS - shipCount)
+        {
+            valid = false;
+            return;
+        }
+        countByLength[shipClass.length] += shipClass.count;
+        shipCount += shipClass.count;
+    }
+
+    if (shipCount == 0)
+    {
+        valid = false;
+        return;
+    }
+
+    for (int length = ShipManager::MAX_LENGTH; length >= ShipManager::MIN_LENGTH; --length)
+    {
+        if (countByLength[length] == 0)
+            continue;
+
+        classes.push_back({length, countByLength[length]});
+        shipSizes.insert(shipSizes.end(), countByLength[length], length);
+        maxLength = std::max(maxLength, length);
+        totalSegments += length * countByLength[length];
+    }
+}
+
+FleetDescriptor FleetDescriptor::parse(const std::string& text)
+{
+    std::vector<ShipClass> shipClasses;
+    std::istringstream in(text);
+    std::string item;
+
+    while (std::getline(in, item, ','))
+    {
+        std::istringstream itemIn(item);
+        ShipClass shipClass {0, 0};
+        char separator = 0;
+        if (!(itemIn >> shipClass.length >> separator >> shipClass.count) || separator != ':' || !(itemIn >> std::ws).eof())
+            return FleetDescriptor(std::vector<ShipClass>());
+        shipClasses.push_back(shipClass);
+    }
+    return FleetDescriptor(shipClasses);
+}
+
+bool FleetDescriptor::fitsOn(int width, int height) const
+{
+    if (!valid || maxLength > std::max(width, height))
+        return false;
+
+    long long paddedCells = static_cast<long long>(width + 1) * (height + 1);
+    long long requiredCells = 0;
+    for (const ShipClass& shipClass : classes)
+        requiredCells += static_cast<long long>(shipClass.length + 1) * 2 * shipClass.count;
+    return requiredCells <= paddedCells;
+}
+
+int FleetDescriptor::getCountOfLength(int length) const
+{
+    for (const ShipClass& shipClass : classes)
+    {
+        if (shipClass.length == length)
+            return shipClass.count;
+    }
+    return 0;
+}
+
+std::string FleetDescriptor::toString() const
+{
+    std::ostringstream out;
+    for (size_t i = 0; i < classes.size(); ++i)
+    {
+        if (i > 0)
+            out << ',';
+        out << classes[i].length << ':' << classes[i].count;
+    }
+    return out.str();
+}
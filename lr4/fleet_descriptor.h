@@ -0,0 +1,43 @@
+#ifndef FLEET_DESCRIPTOR_H
+#define FLEET_DESCRIPTOR_H
+
+#include <string>
+#include <vector>
+
+struct ShipClass
+{
+    int length;
+    int count;
+};
+
+class FleetDescriptor
+{
+public:
+    static const int MAX_SHIPS = 1024;
+
+    FleetDescriptor();
+    explicit FleetDescriptor(const std::vector<ShipClass>& shipClasses);
+
+    static FleetDescriptor parse(const std::string& text);
+
+    bool isValid() const { return valid; }
+    bool fitsOn(int width, int height) const;
+
+    const std::vector<ShipClass>& getClasses() const { return classes; }
+    const std::vector<int>& getShipSizes() const { return shipSizes; }
+    int getShipCount() const { return static_cast<int>(shipSizes.size()); }
+    int getMaxLength() const { return maxLength; }
+    int getTotalSegments() const { return totalSegments; }
+    int getCountOfLength(int length) const;
+
+    std::string toString() const;
+
+private:
+    std::vector<ShipClass> classes;
+    std::vector<int> shipSizes;
+    int maxLength = 0;
+    int totalSegments = 0;
+    bool valid = true;
+};
+
+#endif
@@ -0,0 +1,109 @@
+#include "fleet_placer.h"
+
+#include <algorithm>
+#include <utility>
+
+FleetPlacer::FleetPlacer(GameRng& rng, int maxBacktracks) : rng(rng), maxBacktracks(maxBacktracks)
+{
+}
+
+PlacementReport FleetPlacer::place(GameField& field, ShipManager& ships)
+{
+    if (field.getStorage() == FieldStorage::Sparse)
+        return placeByRejection(field, ships);
+    return placeWithBacktracking(field, ships);
+}
+
+PlacementReport FleetPlacer::placeWithBacktracking(GameField& field, ShipManager& ships)
+{
+    PlacementReport report;
+    if (ships.getShipCount() == 0)
+        return report;
+
+    GameField::BoardState original = field.saveBoard();
+    std::vector<Frame> frames;
+    frames.reserve(ships.getShipCount());
+    frames.push_back(makeFrame(field, ships.getShip(0)->getLength()));
+
+    while (!frames.empty())
+    {
+        Frame& frame = frames.back();
+        size_t depth = frames.size() - 1;
+
+        if (frame.untried == 0)
+        {
+            report.failedShip = std::max(report.failedShip, static_cast<int>(depth));
+            frames.pop_back();
+            if (frames.empty() || report.backtracks == maxBacktracks)
+                break;
+
+            ++report.backtracks;
+            field.restoreBoard(frames.back().before);
+            continue;
+        }
+
+        size_t pick = rng.below(static_cast<uint32_t>(frame.untried));
+        std::swap(frame.candidates[pick], frame.candidates[--frame.untried]);
+        const Candidate& candidate = frame.candidates[frame.untried];
+
+        field.restoreBoard(frame.before);
+        Ship* ship = ships.getShip(depth);
+        if (field.tryPlaceShip(ship, candidate.x, candidate.y, candidate.orientation) != FieldStatus::Ok)
+            continue;
+
+        if (depth + 1 == ships.getShipCount())
+        {
+            report.failedShip = -1;
+            return report;
+        }
+        frames.push_back(makeFrame(field, ships.getShip(depth + 1)->getLength()));
+    }
+
+    field.restoreBoard(original);
+    report.status = PlacementStatus::NoRoom;
+    return report;
+}
+
+FleetPlacer::Frame FleetPlacer::makeFrame(const GameField& field, int length) const
+{
+    Frame frame {field.saveBoard(), {}, 0};
+    for (Orientation orientation : {Orientation::Horizontal, Orientation::Vertical})
+    {
+        if (orientation == Orientation::Vertical && length == 1)
+            break;
+
+        field.getLegalOrigins(length, orientation).forEachSetBit([&](size_t index) {
+            frame.candidates.push_back({static_cast<int>(index % field.getWidth()),
+                                        static_cast<int>(index / field.getWidth()), orientation});
+        });
+    }
+    frame.untried = frame.candidates.size();
+    return frame;
+}
+
+PlacementReport FleetPlacer::placeByRejection(GameField& field, ShipManager& ships)
+{
+    PlacementReport report;
+    GameField::BoardState original = field.saveBoard();
+    for (size_t i = 0; i < ships.getShipCount(); ++i)
+    {
+        Ship* ship = ships.getShip(i);
+        bool placed = false;
+        for (int attempt = 0; attempt < SPARSE_ATTEMPTS && !placed; ++attempt)
+        {
+            int x = static_cast<int>(rng.below(field.getWidth()));
+            int y = static_cast<int>(rng.below(field.getHeight()));
+            Orientation orientation = rng.below(2) == 0 ? Orientation::Horizontal : Orientation::Vertical;
+            placed = field.tryPlaceShip(ship, x, y, orientation) == FieldStatus::Ok;
+        }
+
+        if (!placed)
+        {
+            field.restoreBoard(original);
+            report.status = PlacementStatus::NoRoom;
+            report.failedShip = static_cast<int>(i);
+            return report;
+        }
+    }
+    return report;
+}
@@ -0,0 +1,58 @@
+#ifndef FLEET_PLACER_H
+#define FLEET_PLACER_H
+
+#include <vector>
+
+#include "game_field.h"
+#include "game_rng.h"
+#include "ship_manager.h"
+
+enum class PlacementStatus
+{
+    Placed,
+    NoRoom
+};
+
+struct PlacementReport
+{
+    PlacementStatus status = PlacementStatus::Placed;
+    int failedShip = -1;
+    int backtracks = 0;
+
+    bool ok() const { return status == PlacementStatus::Placed; }
+};
+
+class FleetPlacer
+{
+public:
+    static constexpr int DEFAULT_MAX_BACKTRACKS = 4096;
+    static constexpr int SPARSE_ATTEMPTS = 4096;
+
+    explicit FleetPlacer(GameRng& rng, int maxBacktracks = DEFAULT_MAX_BACKTRACKS);
+
+    PlacementReport place(GameField& field, ShipManager& ships);
+
+private:
+    struct Candidate
+    {
+        int x;
+        int y;
+        Orientation orientation;
+    };
+
+    struct Frame
+    {
+        GameField::BoardState before;
+        std::vector<Candidate> candidates;
+        size_t untried;
+    };
+
+    PlacementReport placeWithBacktracking(GameField& field, ShipManager& ships);
+    PlacementReport placeByRejection(GameField& field, ShipManager& ships);
+    Frame makeFrame(const GameField& field, int length) const;
+
+    GameRng& rng;
+    int maxBacktracks;
+};
+
+#endif
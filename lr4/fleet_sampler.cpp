@@ -0,0 +1,180 @@
+#include "fleet_sampler.h"
+
+#include <algorithm>
+
+namespace
+{
+bool blocksPlacement(Knowledge knowledge)
+{
+    return knowledge == Knowledge::Miss || knowledge == Knowledge::Empty || knowledge == Knowledge::Sunk;
+}
+
+bool isKnownShip(Knowledge knowledge)
+{
+    return knowledge == Knowledge::Ship || knowledge == Knowledge::Damaged || knowledge == Knowledge::Destroyed;
+}
+}
+
+void FleetSampler::prepare(const KnowledgeBoard& knowledge, const FleetDescriptor& fleet)
+{
+    width = knowledge.getWidth();
+    height = knowledge.getHeight();
+    size_t cellCount = static_cast<size_t>(width) * height;
+
+    cells.resize(cellCount);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+            cells[static_cast<size_t>(y) * width + x] = knowledge.at(x, y);
+    }
+
+    std::vector<int> sunkByLength(fleet.getMaxLength() + 1, 0);
+    std::vector<uint8_t> visited(cellCount, 0);
+    std::vector<int> pending;
+    std::vector<uint8_t> forbidden(cellCount, 0);
+    mustCover.clear();
+
+    for (size_t start = 0; start < cellCount; ++start)
+    {
+        if (blocksPlacement(cells[start]))
+            forbidden[start] = 1;
+        if (isKnownShip(cells[start]))
+            mustCover.push_back(static_cast<int>(start));
+        if (cells[start] != Knowledge::Sunk || visited[start])
+            continue;
+
+        int length = 0;
+        pending.assign(1, static_cast<int>(start));
+        visited[start] = 1;
+        while (!pending.empty())
+        {
+            int index = pending.back();
+            pending.pop_back();
+            ++length;
+
+            int x = index % width;
+            int y = index / width;
+            for (int ny = std::max(y - 1, 0); ny <= std::min(y + 1, height - 1); ++ny)
+            {
+                for (int nx = std::max(x - 1, 0); nx <= std::min(x + 1, width - 1); ++nx)
+                {
+                    size_t neighbour = static_cast<size_t>(ny) * width + nx;
+                    forbidden[neighbour] = 1;
+                    if ((nx == x || ny == y) && cells[neighbour] == Knowledge::Sunk && !visited[neighbour])
+                    {
+                        visited[neighbour] = 1;
+                        pending.push_back(static_cast<int>(neighbour));
+                    }
+                }
+            }
+        }
+        if (length < static_cast<int>(sunkByLength.size()))
+            ++sunkByLength[length];
+    }
+
+    remainingLengths.clear();
+    for (const ShipClass& shipClass : fleet.getClasses())
+    {
+        int remaining = std::max(shipClass.count - sunkByLength[shipClass.length], 0);
+        remainingLengths.insert(remainingLengths.end(), remaining, shipClass.length);
+    }
+
+    placements.assign(fleet.getMaxLength() + 1, {});
+    for (int length : remainingLengths)
+    {
+        if (!placements[length].empty())
+            continue;
+
+        for (bool vertical : {false, true})
+        {
+            if (vertical && length == 1)
+                continue;
+
+            int step = vertical ? width : 1;
+            int spanX = vertical ? 1 : length;
+            int spanY = vertical ? length : 1;
+
+            for (int y = 0; y + spanY <= height; ++y)
+            {
+                for (int x = 0; x + spanX <= width; ++x)
+                {
+                    int index = y * width + x;
+                    bool open = true;
+                    bool alive = false;
+                    for (int k = 0; k < length && open; ++k)
+                    {
+                        open = !forbidden[index + k * step];
+                        alive = alive || cells[index + k * step] != Knowledge::Destroyed;
+                    }
+                    if (open && alive)
+                        placements[length].push_back({index, step, vertical});
+                }
+            }
+        }
+    }
+
+    if (blockedStamp.size() != cellCount)
+    {
+        blockedStamp.assign(cellCount, 0);
+        occupiedStamp.assign(cellCount, 0);
+        stamp = 0;
+    }
+}
+
+bool FleetSampler::sample(GameRng& rng)
+{
+    if (++stamp == 0)
+    {
+        std::fill(blockedStamp.begin(), blockedStamp.end(), 0);
+        std::fill(occupiedStamp.begin(), occupiedStamp.end(), 0);
+        stamp = 1;
+    }
+
+    chosen.clear();
+    for (int length : remainingLengths)
+    {
+        const std::vector<Placement>& candidates = placements[length];
+        if (candidates.empty())
+            return false;
+
+        bool placed = false;
+        for (int attempt = 0; attempt < PLACEMENT_TRIES && !placed; ++attempt)
+        {
+            const Placement& candidate = candidates[rng.below(static_cast<uint32_t>(candidates.size()))];
+            placed = true;
+            for (int k = 0; k < length && placed; ++k)
+                placed = blockedStamp[candidate.index + k * candidate.step] != stamp;
+
+            if (placed)
+            {
+                for (int k = 0; k < length; ++k)
+                    occupiedStamp[candidate.index + k * candidate.step] = stamp;
+                markHalo(candidate, length);
+                chosen.push_back(candidate);
+            }
+        }
+        if (!placed)
+            return false;
+    }
+
+    for (int index : mustCover)
+    {
+        if (occupiedStamp[index] != stamp)
+            return false;
+    }
+    return true;
+}
+
+void FleetSampler::markHalo(const Placement& placement, int length)
+{
+    int x = placement.index % width;
+    int y = placement.index / width;
+    int endX = placement.vertical ? x : x + length - 1;
+    int endY = placement.vertical ? y + length - 1 : y;
+
+    for (int ny = std::max(y - 1, 0); ny <= std::min(endY + 1, height - 1); ++ny)
+    {
+        for (int nx = std::max(x - 1, 0); nx <= std::min(endX + 1, width - 1); ++nx)
+            blockedStamp[static_cast<size_t>(ny) * width + nx] = stamp;
+    }
+}
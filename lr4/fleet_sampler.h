@@ -0,0 +1,50 @@
+#ifndef FLEET_SAMPLER_H
+#define FLEET_SAMPLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "fleet_descriptor.h"
+#include "game_rng.h"
+#include "knowledge_board.h"
+
+class FleetSampler
+{
+public:
+    static constexpr int PLACEMENT_TRIES = 64;
+
+    struct Placement
+    {
+        int index;
+        int step;
+        bool vertical;
+    };
+
+    void prepare(const KnowledgeBoard& knowledge, const FleetDescriptor& fleet);
+    bool sample(GameRng& rng);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    size_t getCellCount() const { return cells.size(); }
+    Knowledge cellAt(size_t index) const { return cells[index]; }
+    const std::vector<int>& getRemainingLengths() const { return remainingLengths; }
+    const std::vector<Placement>& getChosen() const { return chosen; }
+
+private:
+    void markHalo(const Placement& placement, int length);
+
+    int width = 0;
+    int height = 0;
+    std::vector<Knowledge> cells;
+    std::vector<int> remainingLengths;
+    std::vector<int> mustCover;
+    std::vector<std::vector<Placement>> placements;
+
+    uint32_t stamp = 0;
+    std::vector<uint32_t> blockedStamp;
+    std::vector<uint32_t> occupiedStamp;
+    std::vector<Placement> chosen;
+};
+
+#endif
@@ -1,19 +1,68 @@
 #include "game.h"
 #include "exceptions.h"
+#include "fleet_placer.h"
 #include "ship_placement_handler.h"
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 
-Game::Game() : gameOver(false), rng(std::random_device{}()) {
+namespace {
+
+bool isComputerTarget(Knowledge known) {
+    return known == Knowledge::Unknown || known == Knowledge::Damaged;
+}
+
+}
+
+Game::Game(int fieldWidth, int fieldHeight, GameMode mode, const FleetDescriptor& fleet, size_t arenaCapacity,
+           uint64_t seed, ComputerStrategy strategy, bool reproducible)
+    : activeArena(std::make_unique<GameArena>(arenaCapacity)),
+      spareArena(std::make_unique<GameArena>(arenaCapacity)),
+      fieldWidth(fieldWidth), fieldHeight(fieldHeight), mode(mode), strategy(strategy), gameOver(false), seed(seed),
+      rng(seed, RngStream::Computer), advisor(GameRng(seed, RngStream::Advisor)),
+      fleetDescriptor(fleet) {
+    if (strategy == ComputerStrategy::MonteCarlo) {
+        monteCarlo = std::make_unique<MonteCarloTargeter>(
+            seed, WorkerPool::defaultWorkers(), std::chrono::milliseconds(MonteCarloTargeter::DEFAULT_BUDGET_MS),
+            reproducible ? SampleBudget::Fixed : SampleBudget::Timed);
+    }
+}
+
+Game::~Game() {
+    ponderer.cancel();
 }
 
 void Game::initializeGame() {
-    userField = std::make_unique<GameField>();
-    computerField = std::make_unique<GameField>();
-    userAbilityManager = std::make_unique<AbilityManager>();
+    releaseState();
+    GameArena& arena = *activeArena;
+
+    userField = arena.make<GameField>(fieldWidth, fieldHeight);
+    computerField = arena.make<GameField>(fieldWidth, fieldHeight);
+
+    userKnowledge = arena.make<KnowledgeBoard>(fieldWidth, fieldHeight, arena.resource());
+    computerKnowledge = arena.make<KnowledgeBoard>(fieldWidth, fieldHeight, arena.resource());
+
+    if (!userField->isValid() || !computerField->isValid()) {
+        std::cerr << "Недопустимый размер поля.\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    if (!userField->supportsTracking() || !userKnowledge->isValid()) {
+        std::cerr << "Игра поддерживает поля не больше " << GameField::MAX_TRACKED_WIDTH << "x"
+                  << GameField::MAX_TRACKED_HEIGHT << ".\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    if (!fleetDescriptor.fitsOn(fieldWidth, fieldHeight)) {
+        std::cerr << "Флот не помещается на поле.\n";
+        std::exit(EXIT_FAILURE);
+    }
+    attachFieldTracking();
+
+    userAbilityManager = arena.make<AbilityManager>(GameRng(seed, RngStream::Abilities));
     userField->setAbilityManager(userAbilityManager.get());
-    userShipManager = std::make_unique<ShipManager>(shipSizes);
-    computerShipManager = std::make_unique<ShipManager>(shipSizes);
+    userShipManager = arena.make<ShipManager>(fleetDescriptor.getShipSizes(), arena.resource());
+    computerShipManager = arena.make<ShipManager>(fleetDescriptor.getShipSizes(), arena.resource());
 
     if (!userShipManager->isValid() || !computerShipManager->isValid()) {
         std::cerr << "Ошибка при инициализации флота.\n";
@@ -24,6 +73,7 @@ void Game::initializeGame() {
     notifyFieldUpdate();
 
     ShipPlacementHandler::placeUserShips(*userField, *userShipManager, *(observers_.front()));
+    indexPlacements();
     notifyFieldUpdate();
 }
 
@@ -40,7 +90,26 @@ void Game::unregisterObserver(IGameObserver* observer) {
     );
 }
 
+void Game::publishChanges() {
+    if (!userFieldChanges.empty()) {
+        ++knowledgeVersion;
+    }
+    for (const CellDelta& delta : userFieldChanges) {
+        if (!isComputerTarget(delta.after)) {
+            targetPool.remove(static_cast<size_t>(delta.y) * computerKnowledge->getWidth() + delta.x);
+        }
+    }
+    for (auto* observer : observers_) {
+        if (!observer) continue;
+        if (!userFieldChanges.empty()) observer->onCellsChanged(*userField, userFieldChanges);
+        if (!computerFieldChanges.empty()) observer->onCellsChanged(*computerField, computerFieldChanges);
+    }
+    userFieldChanges.clear();
+    computerFieldChanges.clear();
+}
+
 void Game::notifyFieldUpdate() {
+    publishChanges();
     for (auto* observer : observers_) {
         if (observer) observer->onFieldUpdate();
     }
@@ -64,59 +133,158 @@ void Game::notifyShipDestroyed() {
     }
 }
 
-void Game::placeComputerShips() {
-    std::uniform_int_distribution<int> coordDistX(0, GameField::DEFAULT_WIDTH - 1);
-    std::uniform_int_distribution<int> coordDistY(0, GameField::DEFAULT_HEIGHT - 1);
-    std::uniform_int_distribution<int> orientationDist(0, 1);
-
-    for (size_t i = 0; i < computerShipManager->getShipCount(); ++i) {
-        Ship* ship = computerShipManager->getShip(i);
-        bool placed = false;
-        while (!placed) {
-            try {
-                int x = coordDistX(rng);
-                int y = coordDistY(rng);
-                Orientation orientation = (orientationDist(rng) == 0) ? 
-                                       Orientation::Horizontal : 
-                                       Orientation::Vertical;
-                computerField->placeShip(ship, x, y, orientation);
-                placed = true;
-            } catch (const ShipPlacementException&) {
+void Game::attachFieldTracking() {
+    computerField->setKnowledgeBoard(userKnowledge.get());
+    userField->setKnowledgeBoard(computerKnowledge.get());
+    userFieldChanges.clear();
+    computerFieldChanges.clear();
+    userField->setChangeLog(&userFieldChanges);
+    computerField->setChangeLog(&computerFieldChanges);
+    ++knowledgeVersion;
+    rebuildTargetPool();
+}
+
+void Game::rebuildTargetPool() {
+    int width = computerKnowledge->getWidth();
+    targetPool.reset(static_cast<size_t>(width) * computerKnowledge->getHeight());
+    for (int y = 0; y < computerKnowledge->getHeight(); ++y) {
+        for (int x = 0; x < width; ++x) {
+            if (isComputerTarget(computerKnowledge->at(x, y))) {
+                targetPool.insert(static_cast<size_t>(y) * width + x);
             }
         }
     }
 }
 
+void Game::indexPlacements() {
+    userField->trackPlacements(fleetDescriptor);
+    computerField->trackPlacements(fleetDescriptor);
+}
+
+void Game::releaseState() {
+    userField.reset();
+    computerField.reset();
+    userShipManager.reset();
+    computerShipManager.reset();
+    userAbilityManager.reset();
+    userKnowledge.reset();
+    computerKnowledge.reset();
+    activeArena->reset();
+}
+
+void Game::swapArenas() {
+    std::swap(activeArena, spareArena);
+    spareArena->reset();
+}
+
+void Game::placeComputerShips() {
+    FleetPlacer placer(rng);
+    PlacementReport report = placer.place(*computerField, *computerShipManager);
+    if (!report.ok()) {
+        std::cerr << "Не удалось расставить флот компьютера (корабль " << report.failedShip + 1
+                  << ", возвратов: " << report.backtracks << ").\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
+
 void Game::computerTurn() {
-    std::uniform_int_distribution<int> coordDistX(0, GameField::DEFAULT_WIDTH - 1);
-    std::uniform_int_distribution<int> coordDistY(0, GameField::DEFAULT_HEIGHT - 1);
+    if (mode == GameMode::Salvo) {
+        computerSalvo();
+        return;
+    }
+
+    if (targetPool.empty()) {
+        return;
+    }
+
+    std::shared_ptr<const PonderResult> scores = computerScores();
+    size_t cell = targetPool.pickBest(rng, [&](size_t target) { return scores->scores[target]; });
+    int x = static_cast<int>(cell % computerKnowledge->getWidth());
+    int y = static_cast<int>(cell / computerKnowledge->getWidth());
+    processAttackResult(userField->attackCell(x, y, *userShipManager));
+}
 
-    bool validAttack = false;
-    int x, y;
+void Game::computerSalvo() {
+    size_t shots = std::min(targetPool.size(), static_cast<size_t>(computerShipManager->getShipRemaining()));
+    std::shared_ptr<const PonderResult> scores = computerScores();
+    std::vector<size_t> cells = targetPool.pickTop(shots, rng, [&](size_t target) { return scores->scores[target]; });
+    std::vector<std::pair<int, int>> candidates;
+    candidates.reserve(shots);
+    for (size_t cell : cells) {
+        candidates.emplace_back(static_cast<int>(cell % computerKnowledge->getWidth()),
+                                static_cast<int>(cell / computerKnowledge->getWidth()));
+    }
+
+    SalvoResult result = userField->attackSalvo(candidates, *userShipManager);
+    processAttackResult({result.hits > 0, result.shipsSunk > 0});
+}
+
+void Game::ponderComputerTurn() {
+    if (gameOver || !computerKnowledge || ponderer.covers(knowledgeVersion)) {
+        return;
+    }
 
-    while (!validAttack) {
-        x = coordDistX(rng);
-        y = coordDistY(rng);
+    ponderer.start(knowledgeVersion, [this, knowledge = KnowledgeBoard(*computerKnowledge), fleet = fleetDescriptor]
+                                     (const std::atomic<bool>& cancelled) {
+        return scoreComputerTargets(knowledge, fleet, nullptr, &cancelled);
+    });
+}
+
+std::shared_ptr<const PonderResult> Game::computerScores() {
+    if (std::shared_ptr<const PonderResult> pondered = ponderer.wait(knowledgeVersion)) {
+        return pondered;
+    }
+    return std::make_shared<const PonderResult>(PonderResult{
+        knowledgeVersion,
+        scoreComputerTargets(*computerKnowledge, fleetDescriptor, &userField->getPlacementIndex(), nullptr)});
+}
 
-        CellStatus currentStatus = userField->getCellStatus(x, y);
-        Ship* ship = userField->getShipAt(x, y);
-        if (currentStatus == CellStatus::Miss || 
-            (ship && ship->getSegmentStatus(userField->getSegmentIndexAt(x, y)) != SegmentStatus::Intact)) {
-            continue;
+std::vector<uint64_t> Game::scoreComputerTargets(const KnowledgeBoard& knowledge, const FleetDescriptor& fleet,
+                                                 const PlacementIndex* index, const std::atomic<bool>* cancelled) {
+    std::vector<uint64_t> scores(static_cast<size_t>(knowledge.getWidth()) * knowledge.getHeight());
+    if (monteCarlo) {
+        monteCarlo->update(knowledge, fleet, cancelled);
+        if (monteCarlo->getSamples() > 0) {
+            for (size_t cell = 0; cell < scores.size(); ++cell) {
+                scores[cell] = monteCarlo->hitsAt(cell);
+            }
+            return scores;
         }
-        validAttack = true;
     }
 
-    bool shipSunk = userField->attackCell(x, y, *userShipManager);
+    targeter.update(knowledge, fleet, index);
+    for (size_t cell = 0; cell < scores.size(); ++cell) {
+        scores[cell] = targeter.score(cell);
+    }
+    return scores;
+}
+
+AbilityAdvice Game::adviseUserAbilities() {
+    return advisor.advise(*userKnowledge, fleetDescriptor, *userAbilityManager);
+}
+
+int Game::getUserSalvoSize() const {
+    return mode == GameMode::Salvo ? userShipManager->getShipRemaining() : 1;
+}
+
+SalvoResult Game::userSalvo(const std::vector<std::pair<int, int>>& targets) {
+    SalvoResult result = computerField->attackSalvo(targets, *computerShipManager);
+    for (int i = 0; i < result.shipsSunk; ++i) {
+        userAbilityManager->addRandomAbility();
+    }
+    return result;
+}
+
+void Game::processAttackResult(const AttackResult& result) {
     notifyFieldUpdate();
 
-    if (shipSunk) {
+    if (result.sunk) {
         notifyShipDestroyed();
     }
 
-    GameResult result = checkWin();
-    if (result != GameResult::NoWin) {
-        handleGameResult(result);
+    GameResult gameResult = checkWin();
+    if (gameResult != GameResult::NoWin) {
+        handleGameResult(gameResult);
     }
 }
 
@@ -144,8 +312,25 @@ void Game::resetGame() {
 }
 
 void Game::startNewRound() {
-    computerField = std::make_unique<GameField>();
-    computerShipManager = std::make_unique<ShipManager>(shipSizes);
+    spareArena->reset();
+    GameArena& arena = *spareArena;
+
+    auto newUserShipManager = arena.make<ShipManager>(*userShipManager, arena.resource());
+    auto newUserField = arena.make<GameField>(userField->cloneWithFleet(*userShipManager, *newUserShipManager));
+    auto newAbilityManager = arena.make<AbilityManager>(std::move(*userAbilityManager));
+    auto newComputerKnowledge = arena.make<KnowledgeBoard>(*computerKnowledge, arena.resource());
+
+    userShipManager = std::move(newUserShipManager);
+    userField = std::move(newUserField);
+    userAbilityManager = std::move(newAbilityManager);
+    computerKnowledge = std::move(newComputerKnowledge);
+    computerField = arena.make<GameField>(fieldWidth, fieldHeight);
+    computerShipManager = arena.make<ShipManager>(fleetDescriptor.getShipSizes(), arena.resource());
+    userKnowledge = arena.make<KnowledgeBoard>(fieldWidth, fieldHeight, arena.resource());
+    swapArenas();
+
+    userField->setAbilityManager(userAbilityManager.get());
+    attachFieldTracking();
 
     if (!computerShipManager->isValid()) {
         std::cerr << "Ошибка при инициализации флота компьютера.\n";
@@ -153,12 +338,14 @@ void Game::startNewRound() {
     }
 
     placeComputerShips();
+    indexPlacements();
     notifyFieldUpdate();
 }
 
 void Game::saveGame(const std::string& filename) {
     try {
-        GameState::saveToFile(filename, *userField, *computerField, *userAbilityManager);
+        GameState::saveToFile(filename, fleetDescriptor, *userField, *computerField,
+                              *userKnowledge, *computerKnowledge, *userAbilityManager);
     } catch (const std::exception& e) {
         throw;
     }
@@ -166,35 +353,55 @@ void Game::saveGame(const std::string& filename) {
 
 void Game::loadGame(const std::string& filename) {
     try {
-        GameField newUserField;
-        GameField newComputerField;
-        AbilityManager newAbilityManager;
+        FleetDescriptor savedFleet = GameState::readFleet(filename);
+        if (!savedFleet.isValid()) {
+            throw std::runtime_error("Ошибка чтения состава флота");
+        }
+
+        spareArena->reset();
+        GameArena& arena = *spareArena;
+
+        auto newUserField = arena.make<GameField>();
+        auto newComputerField = arena.make<GameField>();
+        auto newAbilityManager = arena.make<AbilityManager>(GameRng(seed, RngStream::Abilities));
+        auto newUserKnowledge = arena.make<KnowledgeBoard>(fieldWidth, fieldHeight, arena.resource());
+        auto newComputerKnowledge = arena.make<KnowledgeBoard>(fieldWidth, fieldHeight, arena.resource());
         
-        auto newUserShipManager = std::make_unique<ShipManager>(shipSizes);
-        auto newComputerShipManager = std::make_unique<ShipManager>(shipSizes);
+        auto newUserShipManager = arena.make<ShipManager>(savedFleet.getShipSizes(), arena.resource());
+        auto newComputerShipManager = arena.make<ShipManager>(savedFleet.getShipSizes(), arena.resource());
         
         if (!newUserShipManager->isValid() || !newComputerShipManager->isValid()) {
             throw std::runtime_error("Ошибка создания менеджеров кораблей");
         }
         
         GameState::loadFromFile(filename, 
-                              newUserField, 
-                              newComputerField,
+                              *newUserField, 
+                              *newComputerField,
                               *newUserShipManager, 
                               *newComputerShipManager, 
-                              newAbilityManager);
+                              *newUserKnowledge,
+                              *newComputerKnowledge,
+                              *newAbilityManager);
         
-        if (!newUserField.isValid() || !newComputerField.isValid()) {
+        if (!newUserField->isValid() || !newComputerField->isValid()) {
             throw std::runtime_error("Ошибка загрузки полей");
         }
         
-        userField = std::make_unique<GameField>(std::move(newUserField));
-        computerField = std::make_unique<GameField>(std::move(newComputerField));
+        userField = std::move(newUserField);
+        computerField = std::move(newComputerField);
         userShipManager = std::move(newUserShipManager);
         computerShipManager = std::move(newComputerShipManager);
-        userAbilityManager = std::make_unique<AbilityManager>(std::move(newAbilityManager));
+        userAbilityManager = std::move(newAbilityManager);
+        userKnowledge = std::move(newUserKnowledge);
+        computerKnowledge = std::move(newComputerKnowledge);
+        swapArenas();
+        fleetDescriptor = savedFleet;
         
         userField->setAbilityManager(userAbilityManager.get());
+        attachFieldTracking();
+        fieldWidth = userField->getWidth();
+        fieldHeight = userField->getHeight();
+        indexPlacements();
         
         notifyFieldUpdate();
     } catch (const std::exception& e) {
@@ -2,10 +2,18 @@
 #define GAME_H
 
 #include <memory>
-#include <random>
 #include <vector>
 #include <fstream>
+#include "ability_advisor.h"
+#include "cell_pool.h"
+#include "density_targeter.h"
+#include "monte_carlo_targeter.h"
+#include "ponderer.h"
+#include "game_arena.h"
+#include "game_rng.h"
+#include "fleet_descriptor.h"
 #include "game_field.h"
+#include "knowledge_board.h"
 #include "ship_manager.h"
 #include "ability_manager.h"
 #include "game_state.h"
@@ -20,24 +28,41 @@ enum class GameAction {
     Quit
 };
 
+enum class GameMode {
+    Classic,
+    Salvo
+};
+
+enum class ComputerStrategy {
+    Density,
+    MonteCarlo
+};
+
 enum class GameResult {
     NoWin,
     PlayerWin,
     ComputerWin
 };
 
-struct AttackResult {
-    bool hit;
-    bool sunk;
-};
-
 class Game {
 public:
-    Game();
+    Game(int fieldWidth = GameField::DEFAULT_WIDTH, int fieldHeight = GameField::DEFAULT_HEIGHT,
+         GameMode mode = GameMode::Classic, const FleetDescriptor& fleet = FleetDescriptor(),
+         size_t arenaCapacity = GameArena::DEFAULT_CAPACITY, uint64_t seed = GameRng::randomSeed(),
+         ComputerStrategy strategy = ComputerStrategy::Density, bool reproducible = false);
+    ~Game();
 
     void saveGame(const std::string& filename);
     void loadGame(const std::string& filename);
     void computerTurn();
+    void ponderComputerTurn();
+    SalvoResult userSalvo(const std::vector<std::pair<int, int>>& targets);
+    AbilityAdvice adviseUserAbilities();
+    GameMode getMode() const { return mode; }
+    ComputerStrategy getStrategy() const { return strategy; }
+    uint64_t getSeed() const { return seed; }
+    const FleetDescriptor& getFleetDescriptor() const { return fleetDescriptor; }
+    int getUserSalvoSize() const;
 
     void registerObserver(IGameObserver* observer);
     void unregisterObserver(IGameObserver* observer);
@@ -46,6 +71,8 @@ public:
     const GameField& getComputerField() const { return *computerField; }
     GameField& getUserField() { return *userField; }
     GameField& getComputerField() { return *computerField; }
+    const KnowledgeBoard& getUserKnowledge() const { return *userKnowledge; }
+    const KnowledgeBoard& getComputerKnowledge() const { return *computerKnowledge; }
     AbilityManager* getUserAbilityManager() const { return userAbilityManager.get(); }
     bool isGameOver() const { return gameOver; }
     void setGameOver(bool value) { gameOver = value; }
@@ -60,22 +87,49 @@ protected:
 
 private:
     void showStartMenu();
-    AttackResult processAttackResult(Ship* ship, int segmentIndex);
+    void processAttackResult(const AttackResult& result);
+    void publishChanges();
     GameResult checkWin();
     void resetGame();
     void startNewRound();
     void handleGameResult(GameResult result);
     void placeComputerShips();
+    void computerSalvo();
+    std::shared_ptr<const PonderResult> computerScores();
+    std::vector<uint64_t> scoreComputerTargets(const KnowledgeBoard& knowledge, const FleetDescriptor& fleet,
+                                               const PlacementIndex* index, const std::atomic<bool>* cancelled);
+    void attachFieldTracking();
+    void rebuildTargetPool();
+    void indexPlacements();
+    void releaseState();
+    void swapArenas();
 
-    std::unique_ptr<GameField> userField;
-    std::unique_ptr<GameField> computerField;
-    std::unique_ptr<ShipManager> userShipManager;
-    std::unique_ptr<ShipManager> computerShipManager;
-    std::unique_ptr<AbilityManager> userAbilityManager;
+    std::unique_ptr<GameArena> activeArena;
+    std::unique_ptr<GameArena> spareArena;
+    ArenaPtr<GameField> userField;
+    ArenaPtr<GameField> computerField;
+    ArenaPtr<ShipManager> userShipManager;
+    ArenaPtr<ShipManager> computerShipManager;
+    ArenaPtr<AbilityManager> userAbilityManager;
+    ArenaPtr<KnowledgeBoard> userKnowledge;
+    ArenaPtr<KnowledgeBoard> computerKnowledge;
+    CellChanges userFieldChanges;
+    CellChanges computerFieldChanges;
+    int fieldWidth;
+    int fieldHeight;
+    GameMode mode;
+    ComputerStrategy strategy;
     bool gameOver;
-    std::mt19937 rng;
-    const std::vector<int> shipSizes = {4, 3, 3, 2, 2, 2, 1, 1, 1, 1};
+    uint64_t seed;
+    GameRng rng;
+    AbilityAdvisor advisor;
+    CellPool targetPool;
+    DensityTargeter targeter;
+    std::unique_ptr<MonteCarloTargeter> monteCarlo;
+    FleetDescriptor fleetDescriptor;
     std::vector<IGameObserver*> observers_;
+    uint64_t knowledgeVersion = 0;
+    Ponderer ponderer;
 };
 
 #endif
\ No newline at end of file
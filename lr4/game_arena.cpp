@@ -0,0 +1,7 @@
+#include "game_arena.h"
+
+GameArena::GameArena(size_t capacity)
+    : bufferSize(capacity), buffer(std::make_unique<std::byte[]>(capacity)),
+      pool(buffer.get(), bufferSize, std::pmr::new_delete_resource())
+{
+}
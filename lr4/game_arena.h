@@ -0,0 +1,46 @@
+#ifndef GAME_ARENA_H
+#define GAME_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+struct ArenaDeleter
+{
+    template<typename T>
+    void operator()(T* object) const { object->~T(); }
+};
+
+template<typename T>
+using ArenaPtr = std::unique_ptr<T, ArenaDeleter>;
+
+class GameArena
+{
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+    explicit GameArena(size_t capacity = DEFAULT_CAPACITY);
+
+    std::pmr::memory_resource* resource() { return &pool; }
+    size_t capacity() const { return bufferSize; }
+    void reset() { pool.release(); }
+
+    template<typename T, typename... Args>
+    ArenaPtr<T> make(Args&&... args)
+    {
+        void* memory = pool.allocate(sizeof(T), alignof(T));
+        return ArenaPtr<T>(new (memory) T(std::forward<Args>(args)...));
+    }
+
+private:
+    GameArena(const GameArena&) = delete;
+    GameArena& operator=(const GameArena&) = delete;
+
+    size_t bufferSize;
+    std::unique_ptr<std::byte[]> buffer;
+    std::pmr::monotonic_buffer_resource pool;
+};
+
+#endif
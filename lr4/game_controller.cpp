@@ -1,8 +1,90 @@
 #include "game_controller.h"
 #include "ship_placement_handler.h"
+#include "scanner_ability.h"
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+std::pair<int, int> readAttackCoordinates(int width, int height) {
+    int x, y;
+    std::cout << "Введите координату X для атаки (0-" << width - 1 << "): ";
+    while (!(std::cin >> x) || x < 0 || x >= width) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "Пожалуйста, введите корректную координату X (0-" 
+                << width - 1 << "): ";
+    }
+
+    std::cout << "Введите координату Y для атаки (0-" << height - 1 << "): ";
+    while (!(std::cin >> y) || y < 0 || y >= height) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "Пожалуйста, введите корректную координату Y (0-" 
+                << height - 1 << "): ";
+    }
+    return {x, y};
+}
+
+ScanRegion readScanRegion(int width, int height) {
+    int x, y;
+    std::cout << "Enter the starting X coordinate for scanning (0-" << width - 1 << "): ";
+    std::cin >> x;
+    std::cout << "Enter the starting Y coordinate for scanning (0-" << height - 1 << "): ";
+    std::cin >> y;
+    return ScanRegion::rectangle(x, y, ScannerAbility::AREA_SIZE, ScannerAbility::AREA_SIZE);
+}
+
+void printAdvice(const AbilityAdvice& advice) {
+    if (advice.samples == 0) {
+        std::cout << "Недостаточно данных для подсказки.\n";
+        return;
+    }
+
+    const AbilityEstimate& doubleDamage = advice.estimateFor(AbilityType::DoubleDamage);
+    const AbilityEstimate& scanner = advice.estimateFor(AbilityType::Scanner);
+    const AbilityEstimate& barrage = advice.estimateFor(AbilityType::Barrage);
+
+    std::ios::fmtflags flags = std::cout.flags();
+    std::streamsize precision = std::cout.precision();
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\nПодсказка (расстановок рассмотрено: " << advice.samples << "):\n";
+    std::cout << "  " << AbilityManager::abilityTypeToString(AbilityType::DoubleDamage)
+              << ": вероятность попадания " << doubleDamage.expectedHits;
+    if (doubleDamage.targetX >= 0)
+        std::cout << ", лучшая цель (" << doubleDamage.targetX << ", " << doubleDamage.targetY << ")";
+    std::cout << "\n";
+    std::cout << "  " << AbilityManager::abilityTypeToString(AbilityType::Scanner)
+              << ": ожидаемая информация " << scanner.expectedInformation << " бит";
+    if (scanner.targetX >= 0)
+        std::cout << ", лучшая область от (" << scanner.targetX << ", " << scanner.targetY << ")";
+    std::cout << "\n";
+    std::cout << "  " << AbilityManager::abilityTypeToString(AbilityType::Barrage)
+              << ": попаданий " << barrage.expectedHits << ", шанс потопить корабль " << barrage.sinkChance << "\n";
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+
+    if (advice.hasNext) {
+        std::cout << "Следующая способность: " << AbilityManager::abilityTypeToString(advice.next)
+                  << (advice.useNow ? " - стоит использовать сейчас.\n" : " - лучше подождать.\n");
+    }
+}
+
+void printScanResult(const ScanResult& result) {
+    for (int y = result.y; y < result.y + result.height; ++y) {
+        for (int x = result.x; x < result.x + result.width; ++x) {
+            if (result.shipAt(x, y))
+                std::cout << "Ship segment detectet at (" << x << ", " << y << ")\n";
+            else
+                std::cout << "No ship at (" << x << ", " << y << ")\n";
+        }
+    }
+}
+
+}
 
 MenuChoice DefaultCommandHandler::showStartMenu() const {
     std::cout << "\n=== Морской бой ===\n";
@@ -62,29 +144,30 @@ void DefaultCommandHandler::handleCommand(Command cmd, Game& game) {
         switch(cmd) {
             case Command::Attack:
             {
-                int x, y;
-                std::cout << "Введите координату X для атаки (0-" << GameField::DEFAULT_WIDTH - 1 << "): ";
-                while (!(std::cin >> x) || x < 0 || x >= GameField::DEFAULT_WIDTH) {
-                    std::cin.clear();
-                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-                    std::cout << "Пожалуйста, введите корректную координату X (0-" 
-                            << GameField::DEFAULT_WIDTH - 1 << "): ";
-                }
+                GameField& computerField = game.getComputerField();
+                const int width = computerField.getWidth();
+                const int height = computerField.getHeight();
 
-                std::cout << "Введите координату Y для атаки (0-" << GameField::DEFAULT_HEIGHT - 1 << "): ";
-                while (!(std::cin >> y) || y < 0 || y >= GameField::DEFAULT_HEIGHT) {
-                    std::cin.clear();
-                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-                    std::cout << "Пожалуйста, введите корректную координату Y (0-" 
-                            << GameField::DEFAULT_HEIGHT - 1 << "): ";
-                }
+                if (game.getMode() == GameMode::Salvo) {
+                    int shots = game.getUserSalvoSize();
+                    std::cout << "Залп из " << shots << " выстрелов\n";
 
-                GameField& computerField = game.getComputerField();
-                ShipManager* computerShipManager = game.getComputerShipManager();
+                    std::vector<std::pair<int, int>> targets;
+                    for (int i = 0; i < shots; ++i) {
+                        targets.push_back(readAttackCoordinates(width, height));
+                    }
+
+                    SalvoResult result = game.userSalvo(targets);
+                    std::cout << "Попаданий: " << result.hits << " из " << result.shots
+                              << ", уничтожено кораблей: " << result.shipsSunk << "\n";
+                } else {
+                    auto [x, y] = readAttackCoordinates(width, height);
+                    ShipManager* computerShipManager = game.getComputerShipManager();
 
-                bool shipSunk = computerField.attackCell(x, y, *computerShipManager);
-                if (shipSunk) {
-                    game.getUserAbilityManager()->addRandomAbility();
+                    AttackResult result = computerField.attackCell(x, y, *computerShipManager);
+                    if (result.sunk) {
+                        game.getUserAbilityManager()->addRandomAbility();
+                    }
                 }
 
                 game.computerTurn();
@@ -93,8 +176,15 @@ void DefaultCommandHandler::handleCommand(Command cmd, Game& game) {
 
             case Command::UseAbility:
             {
-                if (game.getUserAbilityManager()->hasAbilities()) {
-                    game.getUserAbilityManager()->useAbility(game.getComputerField());
+                AbilityManager* abilities = game.getUserAbilityManager();
+                if (abilities->hasAbilities()) {
+                    GameField& computerField = game.getComputerField();
+                    if (abilities->peekAbility() == AbilityType::Scanner) {
+                        ScanRegion region = readScanRegion(computerField.getWidth(), computerField.getHeight());
+                        printScanResult(abilities->useAbility(computerField, region).scan);
+                    } else {
+                        abilities->useAbility(computerField);
+                    }
                     std::cout << "Способность использована успешно.\n";
                 } else {
                     std::cout << "У вас нет доступных способностей.\n";
@@ -156,6 +246,13 @@ void DefaultCommandHandler::handleCommand(Command cmd, Game& game) {
                 break;
             }
 
+            case Command::Hint:
+            {
+                AbilityAdvice advice = game.adviseUserAbilities();
+                printAdvice(advice);
+                break;
+            }
+
             case Command::Quit:
                 game.setGameOver(true);
                 std::cout << "Спасибо за игру!\n";
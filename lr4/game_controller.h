@@ -11,6 +11,7 @@ enum class Command {
     LoadGame,
     DisplayFields,
     Quit,
+    Hint,
     Invalid
 };
 
@@ -66,6 +67,7 @@ void GameController<InputProcessor>::processInput() {
         return;
     }
 
+    game_->ponderComputerTurn();
     Command cmd = inputProcessor_.getCommand();
     if (cmd != Command::Invalid) {
         commandHandler_->handleCommand(cmd, *game_);
@@ -3,6 +3,8 @@
 
 #include <memory>
 
+#include "knowledge_board.h"
+
 class Game;
 class GameField;
 class AbilityManager;
@@ -14,6 +16,7 @@ public:
     virtual void onAbilityUsed() = 0;
     virtual void onGameOver() = 0;
     virtual void onShipDestroyed() = 0;
+    virtual void onCellsChanged(const GameField& /* field */, const CellChanges& /* changes */) {}
     virtual void renderShipPlacement(int shipLength, int shipNumber) = 0;
     virtual void renderStartMenu() = 0;
 };
@@ -22,7 +25,7 @@ class IGameRenderer {
 public:
     virtual ~IGameRenderer() = default;
     virtual void renderUserField(const GameField& field) = 0;
-    virtual void renderComputerField(const GameField& field) = 0;
+    virtual void renderComputerField(const KnowledgeBoard& knowledge) = 0;
     virtual void renderAbilityStatus(const AbilityManager& manager) = 0;
     virtual void renderGameStatus(const Game& game) = 0;
     virtual void renderShipPlacement(int shipLength, int shipNumber) = 0;
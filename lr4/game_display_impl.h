@@ -4,6 +4,7 @@
 #include "game_display.h"
 #include "game.h"
 #include "game_field.h"
+#include "knowledge_board.h"
 #include "ability_manager.h"
 
 template<typename Renderer>
@@ -59,10 +60,10 @@ void GameDisplay<Renderer>::updateDisplay() {
     if (!game_) return;
 
     const GameField& userField = game_->getUserField();
-    const GameField& computerField = game_->getComputerField();
+    const KnowledgeBoard& userKnowledge = game_->getUserKnowledge();
 
     renderer_->renderUserField(userField);
-    renderer_->renderComputerField(computerField);
+    renderer_->renderComputerField(userKnowledge);
     renderer_->renderAbilityStatus(*game_->getUserAbilityManager());
     renderer_->renderGameStatus(*game_);
 }
@@ -1,25 +1,336 @@
 #include "game_field.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <unordered_set>
+#include <vector>
 
 #include "ability_manager.h"
 #include "exceptions.h"
+#include "knowledge_board.h"
+#include "placement_masks.h"
 #include "ship.h"
 #include "ship_manager.h"
 
-GameField::GameField(int width, int height) : width(width), height(height), valid(true)
+namespace
 {
-    if (width <= 0 || height <= 0)
+template<typename Board>
+size_t cellIndex(const Board& board, int x, int y)
+{
+    return static_cast<size_t>(y) * board.width() + x;
+}
+
+template<typename Board>
+bool inBounds(const Board& board, int x, int y)
+{
+    return x >= 0 && x < board.width() && y >= 0 && y < board.height();
+}
+
+template<typename Board>
+bool canPlaceByRanges(const Board& board, int length, int x, int y, Orientation orientation)
+{
+    int endX = (orientation == Orientation::Horizontal) ? x + length - 1 : x;
+    int endY = (orientation == Orientation::Vertical) ? y + length - 1 : y;
+
+    if (length <= 0 || !inBounds(board, x, y) || !inBounds(board, endX, endY))
+        return false;
+
+    for (int row = y; row <= endY; ++row)
+    {
+        size_t begin = cellIndex(board, x, row);
+        size_t end = cellIndex(board, endX, row) + 1;
+        if (board.cells().blocked.anyInRange(begin, end) || board.cells().miss.anyInRange(begin, end))
+            return false;
+    }
+    return true;
+}
+
+template<typename Board>
+void blockHaloByRanges(Board& board, int x, int y, int length, Orientation orientation)
+{
+    int endX = (orientation == Orientation::Horizontal) ? x + length - 1 : x;
+    int endY = (orientation == Orientation::Vertical) ? y + length - 1 : y;
+
+    int left = std::max(x - 1, 0);
+    int right = std::min(endX + 1, board.width() - 1);
+    int top = std::max(y - 1, 0);
+    int bottom = std::min(endY + 1, board.height() - 1);
+
+    auto& cells = board.mutableCells();
+    for (int row = top; row <= bottom; ++row)
+        cells.blocked.setRange(cellIndex(board, left, row), cellIndex(board, right, row) + 1);
+}
+
+template<typename Board>
+bool canPlaceOn(const Board& board, int length, int x, int y, Orientation orientation)
+{
+    return canPlaceByRanges(board, length, x, y, orientation);
+}
+
+template<typename Board>
+void blockHalo(Board& board, int x, int y, int length, Orientation orientation)
+{
+    blockHaloByRanges(board, x, y, length, orientation);
+}
+
+template<int W, int H>
+bool canPlaceOn(const FixedBoard<W, H>& board, int length, int x, int y, Orientation orientation)
+{
+    constexpr int maxLength = W > H ? W : H;
+    using Masks = PlacementMasks<W, H, maxLength>;
+
+    if (length > maxLength)
+        return false;
+    if (length <= 0 || !inBounds(board, x, y))
+        return false;
+
+    const auto& mask = Masks::at(length, orientation, x, y);
+    const auto& cells = board.cells();
+    return mask.fits && !cells.blocked.intersects(mask.footprint) && !cells.miss.intersects(mask.footprint);
+}
+
+template<int W, int H>
+void blockHalo(FixedBoard<W, H>& board, int x, int y, int length, Orientation orientation)
+{
+    constexpr int maxLength = W > H ? W : H;
+    using Masks = PlacementMasks<W, H, maxLength>;
+
+    if (length > maxLength)
+        blockHaloByRanges(board, x, y, length, orientation);
+    else
+        board.mutableCells().blocked.setMask(Masks::at(length, orientation, x, y).halo);
+}
+
+template<typename Board>
+int placeOn(Board& board, Ship* ship, int x, int y, Orientation orientation)
+{
+    int id = board.addShip({ship, x, y, orientation});
+    if (id < 0)
+        return id;
+
+    auto& cells = board.mutableCells();
+    size_t step = (orientation == Orientation::Horizontal) ? 1 : board.width();
+    size_t index = cellIndex(board, x, y);
+    for (int i = 0; i < ship->getLength(); ++i, index += step)
+    {
+        cells.occupied.set(index);
+        cells.shipIds[index] = id;
+    }
+    blockHalo(board, x, y, ship->getLength(), orientation);
+    return id;
+}
+
+template<typename Board>
+Bitboard legalOriginsOn(const Board& board, int length, Orientation orientation)
+{
+    Bitboard origins(static_cast<size_t>(board.width()) * board.height());
+    if (length <= 0)
+        return origins;
+
+    const auto& cells = board.cells();
+    std::vector<int> columnRuns(orientation == Orientation::Vertical ? board.width() : 0, 0);
+    for (int y = 0; y < board.height(); ++y)
+    {
+        int rowRun = 0;
+        for (int x = 0; x < board.width(); ++x)
+        {
+            size_t index = cellIndex(board, x, y);
+            bool free = !cells.blocked.test(index) && !cells.miss.test(index);
+
+            if (orientation == Orientation::Horizontal)
+            {
+                rowRun = free ? rowRun + 1 : 0;
+                if (rowRun >= length)
+                    origins.set(index - length + 1);
+            }
+            else
+            {
+                columnRuns[x] = free ? columnRuns[x] + 1 : 0;
+                if (columnRuns[x] >= length)
+                    origins.set(cellIndex(board, x, y - length + 1));
+            }
+        }
+    }
+    return origins;
+}
+
+Bitboard legalOriginsOn(const SparseBoard& /* board */, int /* length */, Orientation /* orientation */)
+{
+    throw std::logic_error("Legal origin map is not available for sparse fields.");
+}
+
+template<typename Board>
+bool hasLegalPlacementOn(const Board& board, int length)
+{
+    return legalOriginsOn(board, length, Orientation::Horizontal).count() > 0 ||
+           legalOriginsOn(board, length, Orientation::Vertical).count() > 0;
+}
+
+bool hasLegalPlacementOn(const SparseBoard& board, int length)
+{
+    if (length <= 0)
+        return false;
+
+    if (length <= board.width())
+    {
+        std::unordered_set<size_t> touchedRows;
+        auto collectRows = [&](size_t chunk, uint64_t) {
+            size_t firstRow = chunk * SparseBitset::CHUNK_BITS / board.width();
+            size_t lastRow = (chunk * SparseBitset::CHUNK_BITS + SparseBitset::CHUNK_BITS - 1) / board.width();
+            for (size_t row = firstRow; row <= lastRow && row < static_cast<size_t>(board.height()); ++row)
+                touchedRows.insert(row);
+        };
+        board.cells().blocked.forEachChunk(collectRows);
+        board.cells().miss.forEachChunk(collectRows);
+        if (touchedRows.size() < static_cast<size_t>(board.height()))
+            return true;
+    }
+
+    for (int y = 0; y < board.height(); ++y)
+    {
+        for (int x = 0; x < board.width(); ++x)
+        {
+            if (canPlaceByRanges(board, length, x, y, Orientation::Horizontal) ||
+                canPlaceByRanges(board, length, x, y, Orientation::Vertical))
+                return true;
+        }
+    }
+    return false;
+}
+
+template<typename Board>
+CellStatus cellStatusOn(const Board& board, size_t index)
+{
+    const auto& cells = board.cells();
+    if (cells.occupied.test(index))
+        return CellStatus::Ship;
+    if (cells.miss.test(index))
+        return CellStatus::Miss;
+    return CellStatus::Empty;
+}
+
+template<typename Cells>
+void markSegment(Cells& cells, size_t index, SegmentStatus status)
+{
+    if (status != SegmentStatus::Intact)
+        cells.hit.set(index);
+    if (status == SegmentStatus::Destroyed)
+        cells.destroyed.set(index);
+}
+
+template<typename Board>
+ScanResult scanOn(const Board& board, const ScanRegion& region, ScanOutput output)
+{
+    ScanRegion bounds = region.boundsWithin(board.width(), board.height());
+    ScanResult result;
+    result.x = bounds.getX();
+    result.y = bounds.getY();
+    result.width = bounds.getWidth();
+    result.height = bounds.getHeight();
+    result.hasCells = output == ScanOutput::WithCells;
+    if (result.hasCells)
+        result.cells.resize(static_cast<size_t>(result.width) * result.height);
+
+    auto collect = [&](size_t base, uint64_t word) {
+        result.shipCells += __builtin_popcountll(word);
+        if (!result.hasCells)
+            return;
+        for (; word; word &= word - 1)
+        {
+            size_t index = base + static_cast<size_t>(__builtin_ctzll(word));
+            int x = static_cast<int>(index % board.width());
+            int y = static_cast<int>(index / board.width());
+            result.cells.set(static_cast<size_t>(y - result.y) * result.width + (x - result.x));
+        }
+    };
+
+    const auto& occupied = board.cells().occupied;
+    if (region.isMask())
+    {
+        const Bitboard& mask = region.getMask();
+        if (mask.size() != static_cast<size_t>(board.width()) * board.height())
+            throw std::invalid_argument("Scan mask does not match the field size.");
+
+        const auto& words = mask.data();
+        for (size_t w = 0; w < words.size(); ++w)
+        {
+            if (!words[w])
+                continue;
+            occupied.forEachWordInRange(w * 64, std::min(w * 64 + 64, mask.size()), [&](size_t base, uint64_t word) {
+                collect(base, word & words[w]);
+            });
+        }
+        return result;
+    }
+
+    for (int row = result.y; row < result.y + result.height; ++row)
+    {
+        size_t begin = cellIndex(board, result.x, row);
+        occupied.forEachWordInRange(begin, begin + result.width, collect);
+    }
+    return result;
+}
+
+template<typename Board>
+Knowledge revealedOn(const Board& board, size_t index)
+{
+    const auto& cells = board.cells();
+    if (cells.miss.test(index))
+        return Knowledge::Miss;
+    if (cells.destroyed.test(index))
+        return Knowledge::Destroyed;
+    if (cells.hit.test(index))
+        return Knowledge::Damaged;
+    return Knowledge::Unknown;
+}
+
+template<typename Board>
+char displayCharOn(const Board& board, size_t index)
+{
+    const auto& cells = board.cells();
+    if (cells.miss.test(index))
+        return 'O';
+    if (!cells.occupied.test(index))
+        return '.';
+    if (cells.shipIds[index] < 0)
+        throw std::runtime_error("Unexpected null ship pointer in ship grid.");
+    if (cells.destroyed.test(index))
+        return 'X';
+    if (cells.hit.test(index))
+        return 'D';
+    return 'S';
+}
+
+template<typename Board>
+int segmentIndexOn(const Board& board, int x, int y)
+{
+    int id = board.cells().shipIds[cellIndex(board, x, y)];
+    if (id < 0)
+        return -1;
+    const PlacedShip& placed = board.ship(id);
+    return (x - placed.x) + (y - placed.y);
+}
+}
+
+GameField::GameField(int width, int height, FieldStorage storage) : width(width), height(height), valid(true)
+{
+    bool sparse = storage == FieldStorage::Sparse ||
+                  (storage == FieldStorage::Auto && (width > MAX_WIDTH || height > MAX_HEIGHT));
+    int maxWidth = sparse ? MAX_SPARSE_WIDTH : MAX_WIDTH;
+    int maxHeight = sparse ? MAX_SPARSE_HEIGHT : MAX_HEIGHT;
+
+    if (width <= 0 || height <= 0 || width > maxWidth || height > maxHeight)
     {
         valid = false;
+        sparse = false;
         this->width = DEFAULT_WIDTH;
         this->height = DEFAULT_HEIGHT;
     }
 
-    field.resize(height, std::vector<CellStatus>(width, CellStatus::Empty));
-    shipGrid.resize(height, std::vector<Ship*>(width, nullptr));
-    segmentIndexGrid.resize(height, std::vector<int>(width, -1));
+    if (sparse)
+        board.emplace<SparseBoard>(this->width, this->height);
+    else if (this->width != DEFAULT_WIDTH || this->height != DEFAULT_HEIGHT)
+        board.emplace<DynamicBoard>(this->width, this->height);
 }
 
 bool GameField::isValid() const
@@ -27,35 +338,30 @@ bool GameField::isValid() const
     return valid;
 }
 
-GameField::GameField(const GameField& other)
-{
-    copyFrom(other);
-}
-
 GameField::GameField(GameField&& other) noexcept
-    : width(other.width), height((other.height)), field(std::move(other.field)), shipGrid(std::move(other.shipGrid)), segmentIndexGrid(std::move(other.segmentIndexGrid))
+    : width(other.width), height(other.height), board(std::move(other.board)),
+      liveSegments(std::move(other.liveSegments)), placements(std::move(other.placements)), valid(other.valid),
+      doubleDamageActivate(other.doubleDamageActivate), abilityManager(other.abilityManager),
+      knowledge(other.knowledge), changeLog(other.changeLog)
 {
     other.width = 0;
     other.height = 0;
 }
 
-GameField& GameField::operator=(const GameField& other)
-{
-    if (this != &other)
-        copyFrom(other);
-
-    return *this;
-}
-
 GameField& GameField::operator=(GameField&& other) noexcept
 {
     if (this != &other)
     {
         width = other.width;
         height = other.height;
-        field = std::move(other.field);
-        shipGrid = std::move(other.shipGrid);
-        segmentIndexGrid = std::move(other.segmentIndexGrid);
+        board = std::move(other.board);
+        liveSegments = std::move(other.liveSegments);
+        placements = std::move(other.placements);
+        valid = other.valid;
+        doubleDamageActivate = other.doubleDamageActivate;
+        abilityManager = other.abilityManager;
+        knowledge = other.knowledge;
+        changeLog = other.changeLog;
         other.width = 0;
         other.height = 0;
     }
@@ -68,83 +374,129 @@ void GameField::copyFrom(const GameField& other)
 {
     width = other.width;
     height = other.height;
-    field = other.field;
-    shipGrid = other.shipGrid;
-    segmentIndexGrid = other.segmentIndexGrid;
+    board = other.board;
+    liveSegments = other.liveSegments;
+    placements.clear();
+    valid = other.valid;
+    doubleDamageActivate = other.doubleDamageActivate;
+    abilityManager = nullptr;
+    knowledge = nullptr;
+    changeLog = nullptr;
 }
 
-bool GameField::isValidPosition(int x, int y) const
+void GameField::clear()
 {
-    return x >= 0 && x < width && y >= 0 && y < width;
+    GameField empty(width, height, getStorage());
+    empty.abilityManager = abilityManager;
+    empty.knowledge = knowledge;
+    empty.changeLog = changeLog;
+    *this = std::move(empty);
 }
 
-bool GameField::canPlaceShip(Ship* ship, int x, int y, Orientation orientation) const
+// Clones share board cells copy-on-write but start detached and without placement tracking;
+// callers reattach the clone and call trackPlacements on it if they need the index.
+GameField GameField::cloneWithFleet(const ShipManager& sourceFleet, ShipManager& targetFleet) const
 {
-    if (!ship)
-        return false;
+    GameField copy;
+    copy.copyFrom(*this);
+    std::visit([&](auto& b) {
+        b.remapShips([&](Ship* ship) { return targetFleet.getShip(sourceFleet.indexOf(ship)); });
+    }, copy.board);
+    return copy;
+}
 
-    int dx = (orientation == Orientation::Horizontal) ? 1 : 0;
-    int dy = (orientation == Orientation::Vertical) ? 1 : 0;
-    int length = ship->getLength();
+GameField::BoardState GameField::saveBoard() const
+{
+    BoardState state;
+    state.board = board;
+    state.liveSegments = liveSegments;
+    return state;
+}
 
-    for (int i = 0; i < length; ++i)
-    {
-        int nx = x + i * dx;
-        int ny = y + i * dy;
+void GameField::restoreBoard(const BoardState& state)
+{
+    board = state.board;
+    liveSegments = state.liveSegments;
+}
 
-        if (!isValidPosition(nx, ny) || field[ny][nx] != CellStatus::Empty || isAdjacentToShip(nx, ny))
-            return false;
-    }
-    return true;
+bool GameField::isValidPosition(int x, int y) const
+{
+    return x >= 0 && x < width && y >= 0 && y < height;
+}
+
+bool GameField::canPlaceShip(int length, int x, int y, Orientation orientation) const
+{
+    return std::visit([&](const auto& b) { return canPlaceOn(b, length, x, y, orientation); }, board);
 }
 
-bool GameField::isAdjacentToShip(int x, int y) const
+void GameField::placeShip(Ship* ship, int x, int y, Orientation orientation)
 {
-    for (int dx = -1; dx <= 1; ++dx)
+    switch (tryPlaceShip(ship, x, y, orientation))
     {
-        for (int dy = -1; dy <= 1; ++dy)
-        {
-            int adjX = x + dx;
-            int adjY = y + dy;
-            if (isValidPosition(adjX, adjY) && field[adjY][adjX] == CellStatus::Ship)
-                return true;
-        }
+        case FieldStatus::Ok:
+            return;
+        case FieldStatus::InvalidShip:
+            throw std::invalid_argument("Ship pointer is null.");
+        default:
+            throw ShipPlacementException();
     }
-    return false;
 }
 
-void GameField::placeShip(Ship* ship, int x, int y, Orientation orientation)
+FieldStatus GameField::tryPlaceShip(Ship* ship, int x, int y, Orientation orientation)
 {
     if (!ship)
-        throw std::invalid_argument("Ship pointer is null.");
+        return FieldStatus::InvalidShip;
 
-    if (!canPlaceShip(ship, x, y, orientation))
-        throw ShipPlacementException();
+    if (!canPlaceShip(ship->getLength(), x, y, orientation))
+        return FieldStatus::PlacementBlocked;
 
     ship->setOrientation(orientation);
 
-    int dx = (orientation == Orientation::Horizontal) ? 1 : 0;
-    int dy = (orientation == Orientation::Vertical) ? 1 : 0;
-    int length = ship->getLength();
+    int id = std::visit([&](auto& b) { return placeOn(b, ship, x, y, orientation); }, board);
+    if (id < 0)
+        return FieldStatus::FieldFull;
+    ship->setOrigin(x, y);
 
-    for (int i = 0; i < length; ++i)
+    for (int i = 0; i < ship->getLength(); ++i)
     {
-        int nx = x + i * dx;
-        int ny = y + i * dy;
-
-        field[ny][nx] = CellStatus::Ship;
-        shipGrid[ny][nx] = ship;
-        segmentIndexGrid[ny][nx] = i;
+        if (ship->getSegmentStatus(i) != SegmentStatus::Destroyed)
+            liveSegments.add(id, i);
     }
-    shipsInField.insert(ship);
+    return FieldStatus::Ok;
 }
 
 CellStatus GameField::getCellStatus(int x, int y) const
 {
-    if (!isValidPosition(x, y))
+    FieldResult<CellStatus> result = tryGetCellStatus(x, y);
+    if (!result.ok())
         throw std::out_of_range("Cell position out of range.");
+    return result.value;
+}
+
+FieldResult<CellStatus> GameField::tryGetCellStatus(int x, int y) const
+{
+    return std::visit([&](const auto& b) {
+        if (!inBounds(b, x, y))
+            return FieldResult<CellStatus>{FieldStatus::OutOfBounds, CellStatus::Unknown};
+        return FieldResult<CellStatus>{FieldStatus::Ok, cellStatusOn(b, cellIndex(b, x, y))};
+    }, board);
+}
 
-    return field[y][x];
+void GameField::setCellStatus(int x, int y, CellStatus status)
+{
+    if (!isValidPosition(x, y))
+        throw OutOfBoundsException();
+    if (status == CellStatus::Ship)
+        throw std::invalid_argument("Ship cells are set by placing a ship.");
+
+    std::visit([&](auto& b) {
+        auto& cells = b.mutableCells();
+        size_t index = cellIndex(b, x, y);
+        cells.occupied.reset(index);
+        cells.miss.reset(index);
+        if (status == CellStatus::Miss)
+            cells.miss.set(index);
+    }, board);
 }
 
 void GameField::activateDoubleDamage()
@@ -152,20 +504,40 @@ void GameField::activateDoubleDamage()
     doubleDamageActivate = true;
 }
 
-bool GameField::attackCell(int x, int y, ShipManager &shipManager)
+AttackResult GameField::attackCell(int x, int y, ShipManager &shipManager)
 {
-    if (!isValidPosition(x, y))
+    FieldResult<AttackResult> result = tryAttackCell(x, y, shipManager);
+    if (!result.ok())
         throw std::out_of_range("Cell position out of range.");
+    return result.value;
+}
 
-    bool shipSunk = false;
+FieldResult<AttackResult> GameField::tryAttackCell(int x, int y, ShipManager &shipManager)
+{
+    return std::visit([&](auto& b) {
+        if (!inBounds(b, x, y))
+            return FieldResult<AttackResult>{FieldStatus::OutOfBounds, {false, false}};
 
-    if (field[y][x] == CellStatus::Ship)
-    {
-        Ship* ship = shipGrid[y][x];
-        if (!ship)
+        size_t index = cellIndex(b, x, y);
+        if (!b.cells().occupied.test(index))
+        {
+            if (!b.cells().miss.test(index))
+            {
+                Knowledge before = knownStateAt(x, y);
+                b.mutableCells().miss.set(index);
+                emitChange({x, y, before, Knowledge::Miss, -1, false});
+            }
+            return FieldResult<AttackResult>{FieldStatus::Ok, {false, false}};
+        }
+
+        int id = b.cells().shipIds[index];
+        if (id < 0)
             throw std::runtime_error("Unexpected null ship pointer in ship grid.");
 
-        int segmentIndex = segmentIndexGrid[y][x];
+        Ship* ship = b.ship(id).ship;
+        int segmentIndex = segmentIndexOn(b, x, y);
+        Knowledge before = knownStateAt(x, y);
+        bool wasSunk = ship->isSunk();
 
         int damage = 1;
         if (doubleDamageActivate)
@@ -174,55 +546,282 @@ bool GameField::attackCell(int x, int y, ShipManager &shipManager)
             doubleDamageActivate = false;
         }
         ship->applyDamage(segmentIndex, damage);
+        markSegment(b.mutableCells(), index, ship->getSegmentStatus(segmentIndex));
         shipManager.updateShip(ship);
+        recordSegmentChange(id, segmentIndex, before, wasSunk);
 
-        if (ship->isSunk())
-            shipSunk = true;
-    }
-    else if (field[y][x] == CellStatus::Empty || field[y][x] == CellStatus::Unknown)
+        return FieldResult<AttackResult>{FieldStatus::Ok, {true, !wasSunk && ship->isSunk()}};
+    }, board);
+}
+
+SalvoResult GameField::attackSalvo(const std::vector<std::pair<int, int>>& targets, ShipManager& shipManager)
+{
+    for (const auto& [x, y] : targets)
     {
-        field[y][x] = CellStatus::Miss;
+        if (!isValidPosition(x, y))
+            throw std::out_of_range("Cell position out of range.");
     }
 
-    return shipSunk;
-}
+    return std::visit([&](auto& b) {
+        std::vector<size_t> indices;
+        indices.reserve(targets.size());
+        for (const auto& [x, y] : targets)
+            indices.push_back(cellIndex(b, x, y));
+        std::sort(indices.begin(), indices.end());
+        indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
 
-char GameField::getDisplayCharAt(int x, int y) const
-{
-    if (!isValidPosition(x, y))
-        throw std::out_of_range("Cell position out of range.");
+        std::vector<std::pair<size_t, uint64_t>> shots;
+        for (size_t index : indices)
+        {
+            size_t word = index >> 6;
+            if (shots.empty() || shots.back().first != word)
+                shots.emplace_back(word, 0);
+            shots.back().second |= uint64_t(1) << (index & 63);
+        }
 
-    switch (field[y][x])
-    {
-        case CellStatus::Unknown:
-            return '?';
-        case CellStatus::Empty:
-            return '.';
-        case CellStatus::Miss:
-            return 'O';
-        case CellStatus::Ship:
+        SalvoResult result;
+        result.shots = static_cast<int>(indices.size());
+
+        for (const auto& [word, bits] : shots)
         {
-            Ship* ship = shipGrid[y][x];
-            if (!ship)
-                throw std::runtime_error("Unexpected null ship pointer in ship grid.");
+            uint64_t misses = bits & ~b.cells().occupied.wordAt(word) & ~b.cells().miss.wordAt(word);
+            if (!misses)
+                continue;
 
-            int segmentIndex = segmentIndexGrid[y][x];
-            SegmentStatus segmentStatus = ship->getSegmentStatus(segmentIndex);
-            switch (segmentStatus)
+            for (uint64_t rest = misses; rest; rest &= rest - 1)
             {
-                case SegmentStatus::Intact:
-                    return 'S';
-                case SegmentStatus::Damaged:
-                    return 'D';
-                case SegmentStatus::Destroyed:
-                    return 'X';
+                size_t index = word * 64 + static_cast<size_t>(__builtin_ctzll(rest));
+                int x = static_cast<int>(index % width);
+                int y = static_cast<int>(index / width);
+                emitChange({x, y, knownStateAt(x, y), Knowledge::Miss, -1, false});
             }
+            b.mutableCells().miss.setBitsInWord(word, misses);
         }
+
+        std::vector<int> touchedShips;
+        for (const auto& [word, bits] : shots)
+        {
+            for (uint64_t hits = bits & b.cells().occupied.wordAt(word); hits; hits &= hits - 1)
+            {
+                size_t index = word * 64 + static_cast<size_t>(__builtin_ctzll(hits));
+                int x = static_cast<int>(index % width);
+                int y = static_cast<int>(index / width);
+                int id = b.cells().shipIds[index];
+                Ship* ship = b.ship(id).ship;
+                int segmentIndex = segmentIndexOn(b, x, y);
+                Knowledge before = knownStateAt(x, y);
+                bool wasSunk = ship->isSunk();
+
+                int damage = 1;
+                if (doubleDamageActivate)
+                {
+                    damage *= 2;
+                    doubleDamageActivate = false;
+                }
+                ship->applyDamage(segmentIndex, damage);
+                markSegment(b.mutableCells(), index, ship->getSegmentStatus(segmentIndex));
+                recordSegmentChange(id, segmentIndex, before, wasSunk);
+
+                if (std::find(touchedShips.begin(), touchedShips.end(), id) == touchedShips.end())
+                    touchedShips.push_back(id);
+                ++result.hits;
+                if (!wasSunk && ship->isSunk())
+                    ++result.shipsSunk;
+            }
+        }
+
+        for (int id : touchedShips)
+            shipManager.updateShip(b.ship(id).ship);
+
+        return result;
+    }, board);
+}
+
+void GameField::damageShipSegment(int shipId, int segmentIndex, int damage)
+{
+    if (shipId < 0 || shipId >= getShipCount())
+        throw std::out_of_range("Ship id out of range.");
+
+    std::visit([&](auto& b) {
+        const PlacedShip& placed = b.ship(shipId);
+        int x = placed.x + (placed.orientation == Orientation::Horizontal ? segmentIndex : 0);
+        int y = placed.y + (placed.orientation == Orientation::Vertical ? segmentIndex : 0);
+        Knowledge before = knownStateAt(x, y);
+        bool wasSunk = placed.ship->isSunk();
+
+        placed.ship->applyDamage(segmentIndex, damage);
+        markSegment(b.mutableCells(), cellIndex(b, x, y), placed.ship->getSegmentStatus(segmentIndex));
+        recordSegmentChange(shipId, segmentIndex, before, wasSunk);
+    }, board);
+}
+
+Knowledge GameField::knownStateAt(int x, int y) const
+{
+    if (knowledge)
+        return knowledge->at(x, y);
+
+    return std::visit([&](const auto& b) { return revealedOn(b, cellIndex(b, x, y)); }, board);
+}
+
+void GameField::recordSegmentChange(int shipId, int segmentIndex, Knowledge before, bool wasSunk)
+{
+    const PlacedShip& placed = getPlacedShip(shipId);
+    if (placed.ship->getSegmentStatus(segmentIndex) == SegmentStatus::Destroyed)
+        liveSegments.remove(shipId, segmentIndex);
+
+    int dx = placed.orientation == Orientation::Horizontal ? 1 : 0;
+    int dy = placed.orientation == Orientation::Vertical ? 1 : 0;
+
+    if (!placed.ship->isSunk())
+    {
+        Knowledge after = placed.ship->getSegmentStatus(segmentIndex) == SegmentStatus::Destroyed ?
+                          Knowledge::Destroyed : Knowledge::Damaged;
+        emitChange({placed.x + dx * segmentIndex, placed.y + dy * segmentIndex, before, after, shipId, false});
+        return;
+    }
+
+    if (wasSunk)
+        return;
+
+    placements.recordSunk(placed.ship->getLength());
+    for (int i = 0; i < placed.ship->getLength(); ++i)
+    {
+        int x = placed.x + dx * i;
+        int y = placed.y + dy * i;
+        emitChange({x, y, i == segmentIndex ? before : knownStateAt(x, y), Knowledge::Sunk, shipId, true});
+    }
+}
+
+void GameField::emitChange(const CellDelta& delta)
+{
+    if (delta.before == delta.after)
+        return;
+
+    if (changeLog)
+        changeLog->push_back(delta);
+    if (knowledge)
+        knowledge->apply(delta);
+    placements.observe(delta.x, delta.y, delta.after);
+}
+
+ScanResult GameField::scan(const ScanRegion& region, ScanOutput output) const
+{
+    return std::visit([&](const auto& b) { return scanOn(b, region, output); }, board);
+}
+
+ScanResult GameField::revealRegion(const ScanRegion& region)
+{
+    ScanResult result = scan(region, ScanOutput::WithCells);
+    auto reveal = [&](int x, int y) {
+        if (knownStateAt(x, y) == Knowledge::Unknown)
+            emitChange({x, y, Knowledge::Unknown, result.shipAt(x, y) ? Knowledge::Ship : Knowledge::Empty, -1, false});
+    };
+
+    if (region.isMask())
+    {
+        region.getMask().forEachSetBit([&](size_t index) {
+            reveal(static_cast<int>(index % width), static_cast<int>(index / width));
+        });
+        return result;
+    }
+
+    for (int y = result.y; y < result.y + result.height; ++y)
+    {
+        for (int x = result.x; x < result.x + result.width; ++x)
+            reveal(x, y);
+    }
+    return result;
+}
+
+bool GameField::scanCell(int x, int y)
+{
+    bool shipFound = getCellStatus(x, y) == CellStatus::Ship;
+    Knowledge before = knownStateAt(x, y);
+    if (before == Knowledge::Unknown)
+        emitChange({x, y, before, shipFound ? Knowledge::Ship : Knowledge::Empty, -1, false});
+    return shipFound;
+}
+
+char GameField::getDisplayCharAt(int x, int y) const
+{
+    return std::visit([&](const auto& b) {
+        if (!inBounds(b, x, y))
+            throw std::out_of_range("Cell position out of range.");
+        return displayCharOn(b, cellIndex(b, x, y));
+    }, board);
+}
+
+bool GameField::isCellBlocked(int x, int y) const
+{
+    return std::visit([&](const auto& b) {
+        if (!inBounds(b, x, y))
+            throw std::out_of_range("Cell position out of range.");
+        return b.cells().blocked.test(cellIndex(b, x, y));
+    }, board);
+}
+
+Bitboard GameField::getLegalOrigins(int length, Orientation orientation) const
+{
+    return std::visit([&](const auto& b) { return legalOriginsOn(b, length, orientation); }, board);
+}
+
+bool GameField::hasLegalPlacement(int length) const
+{
+    return std::visit([&](const auto& b) { return hasLegalPlacementOn(b, length); }, board);
+}
+
+FieldStatus GameField::trackPlacements(const FleetDescriptor& fleet)
+{
+    if (!supportsTracking())
+        return FieldStatus::OutOfBounds;
+
+    placements.reset(width, height, fleet.getClasses());
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+            placements.observe(x, y, knownStateAt(x, y));
     }
-    return '?';
+    for (int shipId = 0; shipId < getShipCount(); ++shipId)
+    {
+        const Ship* ship = getPlacedShip(shipId).ship;
+        if (ship->isSunk())
+            placements.recordSunk(ship->getLength());
+    }
+    return FieldStatus::Ok;
+}
+
+bool GameField::supportsTracking() const
+{
+    return width <= MAX_TRACKED_WIDTH && height <= MAX_TRACKED_HEIGHT;
+}
+
+FieldStorage GameField::getStorage() const
+{
+    return std::holds_alternative<SparseBoard>(board) ? FieldStorage::Sparse : FieldStorage::Dense;
+}
+
+int GameField::getShipCount() const
+{
+    return std::visit([](const auto& b) { return b.shipCount(); }, board);
+}
+
+const PlacedShip& GameField::getPlacedShip(int shipId) const
+{
+    if (shipId < 0 || shipId >= getShipCount())
+        throw std::out_of_range("Ship id out of range.");
+
+    return std::visit([&](const auto& b) -> const PlacedShip& { return b.ship(shipId); }, board);
+}
+
+Ship* GameField::getShipAt(int x, int y) const
+{
+    return std::visit([&](const auto& b) -> Ship* {
+        int id = b.cells().shipIds[cellIndex(b, x, y)];
+        return id < 0 ? nullptr : b.ship(id).ship;
+    }, board);
 }
 
-const std::unordered_set<Ship*>& GameField::getAllShips() const
+int GameField::getSegmentIndexAt(int x, int y) const
 {
-    return shipsInField;
+    return std::visit([&](const auto& b) { return segmentIndexOn(b, x, y); }, board);
 }
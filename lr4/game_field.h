@@ -1,12 +1,19 @@
 #ifndef GAME_FIELD_H
 #define GAME_FIELD_H
 
-#include <unordered_set>
+#include <utility>
+#include <variant>
 #include <vector>
 
+#include "board_storage.h"
 #include "ship.h"
 #include "ship_manager.h"
 #include "exceptions.h"
+#include "fleet_descriptor.h"
+#include "knowledge_board.h"
+#include "live_segment_index.h"
+#include "placement_index.h"
+#include "scan_region.h"
 
 class AbilityManager;
 
@@ -18,57 +25,138 @@ enum class CellStatus
     Miss
 };
 
+struct AttackResult
+{
+    bool hit;
+    bool sunk;
+};
+
+struct SalvoResult
+{
+    int shots = 0;
+    int hits = 0;
+    int shipsSunk = 0;
+};
+
+enum class FieldStatus
+{
+    Ok,
+    OutOfBounds,
+    InvalidShip,
+    PlacementBlocked,
+    FieldFull
+};
+
+template<typename T>
+struct FieldResult
+{
+    FieldStatus status;
+    T value;
+
+    bool ok() const { return status == FieldStatus::Ok; }
+};
+
+enum class FieldStorage
+{
+    Auto,
+    Dense,
+    Sparse
+};
+
 class GameField
 {
 public:
-    static const int DEFAULT_WIDTH = 10;
-    static const int DEFAULT_HEIGHT = 10;
+    using StandardBoard = ::StandardBoard;
+
+    static constexpr int DEFAULT_WIDTH = StandardBoard::WIDTH;
+    static constexpr int DEFAULT_HEIGHT = StandardBoard::HEIGHT;
+    static constexpr int MAX_WIDTH = 1024;
+    static constexpr int MAX_HEIGHT = 1024;
+    static constexpr int MAX_SPARSE_WIDTH = 1 << 20;
+    static constexpr int MAX_SPARSE_HEIGHT = 1 << 20;
+    // Knowledge boards, placement tracking and legal-origin maps stay dense, so a sparse
+    // field larger than KnowledgeBoard::MAX_WIDTH x MAX_HEIGHT supports cell-level play only.
+    static constexpr int MAX_TRACKED_WIDTH = KnowledgeBoard::MAX_WIDTH;
+    static constexpr int MAX_TRACKED_HEIGHT = KnowledgeBoard::MAX_HEIGHT;
 
     bool isValid() const;
 
-    GameField(int width = DEFAULT_WIDTH, int height = DEFAULT_HEIGHT);
-    GameField(const GameField& other);
+    GameField(int width = DEFAULT_WIDTH, int height = DEFAULT_HEIGHT, FieldStorage storage = FieldStorage::Auto);
+    GameField(const GameField&) = delete;
     GameField(GameField&& other) noexcept;
-    GameField& operator=(const GameField& other);
+    GameField& operator=(const GameField&) = delete;
     GameField& operator=(GameField&& other) noexcept;
     ~GameField();
 
+    class BoardState
+    {
+        friend class GameField;
+
+        std::variant<StandardBoard, DynamicBoard, SparseBoard> board;
+        LiveSegmentIndex liveSegments;
+    };
+
+    void clear();
+    GameField cloneWithFleet(const ShipManager& sourceFleet, ShipManager& targetFleet) const;
+    BoardState saveBoard() const;
+    void restoreBoard(const BoardState& state);
+
     void placeShip(Ship* ship, int x, int y, Orientation orientation);
+    FieldStatus tryPlaceShip(Ship* ship, int x, int y, Orientation orientation);
+    bool canPlaceShip(int length, int x, int y, Orientation orientation) const;
+    bool isCellBlocked(int x, int y) const;
+    Bitboard getLegalOrigins(int length, Orientation orientation) const;
+    bool hasLegalPlacement(int length) const;
+    FieldStorage getStorage() const;
+    bool supportsTracking() const;
     CellStatus getCellStatus(int x, int y) const;
-    bool attackCell(int x, int y, ShipManager& shipManager);
+    FieldResult<CellStatus> tryGetCellStatus(int x, int y) const;
+    AttackResult attackCell(int x, int y, ShipManager& shipManager);
+    FieldResult<AttackResult> tryAttackCell(int x, int y, ShipManager& shipManager);
+    SalvoResult attackSalvo(const std::vector<std::pair<int, int>>& targets, ShipManager& shipManager);
+    bool scanCell(int x, int y);
+    ScanResult scan(const ScanRegion& region, ScanOutput output = ScanOutput::CountOnly) const;
+    ScanResult revealRegion(const ScanRegion& region);
     char getDisplayCharAt(int x, int y) const;
 
     bool isValidPosition(int x, int y) const;
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
     void activateDoubleDamage();
-    const std::unordered_set<Ship*>& getAllShips() const;
+    int getShipCount() const;
+    const PlacedShip& getPlacedShip(int shipId) const;
+    void damageShipSegment(int shipId, int segmentIndex, int damage);
+    const LiveSegmentIndex& getLiveSegments() const { return liveSegments; }
+    FieldStatus trackPlacements(const FleetDescriptor& fleet);
+    const PlacementIndex& getPlacementIndex() const { return placements; }
 
     void setAbilityManager(AbilityManager* manager) { abilityManager = manager; }
+    void setKnowledgeBoard(KnowledgeBoard* board) { knowledge = board; }
+    void setChangeLog(CellChanges* log) { changeLog = log; }
 
-    Ship* getShipAt(int x, int y) const { return shipGrid[y][x]; }
-    int getSegmentIndexAt(int x, int y) const { return segmentIndexGrid[y][x]; }
+    Ship* getShipAt(int x, int y) const;
+    int getSegmentIndexAt(int x, int y) const;
 
-    void setCellStatus(int x, int y, CellStatus status) {
-    if (!isValidPosition(x, y))
-        throw OutOfBoundsException();
-    field[y][x] = status;
-}
+    void setCellStatus(int x, int y, CellStatus status);
 
 private:
     int width;
     int height;
-    std::vector<std::vector<CellStatus>> field;
-    std::vector<std::vector<Ship*>> shipGrid;
-    std::vector<std::vector<int>> segmentIndexGrid;
+    std::variant<StandardBoard, DynamicBoard, SparseBoard> board;
+    LiveSegmentIndex liveSegments;
+    PlacementIndex placements;
 
-    bool canPlaceShip(Ship* ship, int x, int y, Orientation orientation) const;
-    bool isAdjacentToShip(int x, int y) const;
     void copyFrom(const GameField& other);
+    Knowledge knownStateAt(int x, int y) const;
+    void recordSegmentChange(int shipId, int segmentIndex, Knowledge before, bool wasSunk);
+    void emitChange(const CellDelta& delta);
 
     bool valid;
     bool doubleDamageActivate = false;
-    std::unordered_set<Ship*> shipsInField;
 
     AbilityManager* abilityManager = nullptr;
+    KnowledgeBoard* knowledge = nullptr;
+    CellChanges* changeLog = nullptr;
 };
 
 #endif
@@ -0,0 +1,28 @@
+#include "game_rng.h"
+
+#include <random>
+
+namespace
+{
+uint64_t splitMix(uint64_t& value)
+{
+    uint64_t z = (value += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+}
+
+GameRng::GameRng(uint64_t seed, uint64_t stream)
+{
+    uint64_t mix = seed;
+    mix ^= splitMix(stream);
+    for (auto& word : state)
+        word = splitMix(mix);
+}
+
+uint64_t GameRng::randomSeed()
+{
+    std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32) ^ device();
+}
@@ -0,0 +1,65 @@
+#ifndef GAME_RNG_H
+#define GAME_RNG_H
+
+#include <cstdint>
+#include <limits>
+
+enum class RngStream : uint64_t
+{
+    Computer = 1,
+    Abilities = 2,
+    Advisor = 3,
+    MonteCarlo = 4
+};
+
+class GameRng
+{
+public:
+    using result_type = uint64_t;
+
+    explicit GameRng(uint64_t seed = 0, uint64_t stream = 0);
+    GameRng(uint64_t seed, RngStream stream) : GameRng(seed, static_cast<uint64_t>(stream)) {}
+
+    static uint64_t randomSeed();
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()()
+    {
+        uint64_t result = rotl(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+
+        return result;
+    }
+
+    uint32_t below(uint32_t bound)
+    {
+        uint64_t product = ((*this)() >> 32) * bound;
+        uint32_t low = static_cast<uint32_t>(product);
+        if (low < bound)
+        {
+            uint32_t threshold = -bound % bound;
+            while (low < threshold)
+            {
+                product = ((*this)() >> 32) * bound;
+                low = static_cast<uint32_t>(product);
+            }
+        }
+        return static_cast<uint32_t>(product >> 32);
+    }
+
+private:
+    static uint64_t rotl(uint64_t value, int shift) { return (value << shift) | (value >> (64 - shift)); }
+
+    uint64_t state[4];
+};
+
+#endif
@@ -3,17 +3,18 @@
 #include "ability_manager.h"
 #include "ship_manager.h"
 #include "ship.h"
-#include "double_damage_ability.h"
-#include "scanner_ability.h"
-#include "barrage_ability.h"
+#include <algorithm>
 #include <iostream>
 
 std::ostream& operator<<(std::ostream& os, const GameState& state) {
-    os << GameField::DEFAULT_WIDTH << ' ' << GameField::DEFAULT_HEIGHT << '\n';
+    os << state.userFieldData.width << ' ' << state.userFieldData.height << '\n';
+    os << "fleet " << state.fleet.toString() << '\n';
     
     GameState::writeFieldData(os, state.userFieldData);
     GameState::writeFieldData(os, state.computerFieldData);
     GameState::writeAbilitiesData(os, state.abilitiesData);
+    GameState::writeKnowledgeData(os, state.userKnowledgeData, state.computerFieldData.width, state.computerFieldData.height);
+    GameState::writeKnowledgeData(os, state.computerKnowledgeData, state.userFieldData.width, state.userFieldData.height);
     
     return os;
 }
@@ -24,20 +25,32 @@ std::istream& operator>>(std::istream& is, GameState& state) {
         throw std::runtime_error("Error reading dimensions");
     }
     
-    if (width != GameField::DEFAULT_WIDTH || height != GameField::DEFAULT_HEIGHT) {
+    if (width <= 0 || height <= 0 || width > GameField::MAX_WIDTH || height > GameField::MAX_HEIGHT) {
         throw std::runtime_error("Invalid dimensions in save file");
     }
+
+    state.fleet = GameState::readFleetData(is);
+    if (!state.fleet.isValid()) {
+        throw std::runtime_error("Invalid fleet in save file");
+    }
     
-    state.userFieldData = GameState::readFieldData(is);
-    state.computerFieldData = GameState::readFieldData(is);
+    state.userFieldData = GameState::readFieldData(is, width, height);
+    state.computerFieldData = GameState::readFieldData(is, width, height);
     state.abilitiesData = GameState::readAbilitiesData(is);
+    state.userKnowledgeData = GameState::readKnowledgeData(is, width, height);
+    if (state.userKnowledgeData.present) {
+        state.computerKnowledgeData = GameState::readKnowledgeData(is, width, height);
+    }
     
     return is;
 }
 
 void GameState::saveToFile(const std::string& filename,
+                          const FleetDescriptor& fleet,
                           const GameField& userField,
                           const GameField& computerField,
+                          const KnowledgeBoard& userKnowledge,
+                          const KnowledgeBoard& computerKnowledge,
                           const AbilityManager& abilities) {
     std::ofstream out(filename, std::ios::binary);
     if (!out) {
@@ -46,9 +59,12 @@ void GameState::saveToFile(const std::string& filename,
 
     try {
         GameState state;
+        state.fleet = fleet;
         state.userFieldData = serializeField(userField);
         state.computerFieldData = serializeField(computerField);
         state.abilitiesData = serializeAbilities(abilities);
+        state.userKnowledgeData = serializeKnowledge(userKnowledge);
+        state.computerKnowledgeData = serializeKnowledge(computerKnowledge);
 
         out << state;
 
@@ -66,6 +82,8 @@ void GameState::loadFromFile(const std::string& filename,
                            GameField& computerField,
                            ShipManager& userShips,
                            ShipManager& computerShips,
+                           KnowledgeBoard& userKnowledge,
+                           KnowledgeBoard& computerKnowledge,
                            AbilityManager& abilities) {
     std::ifstream in(filename, std::ios::binary);
     if (!in) {
@@ -79,24 +97,53 @@ void GameState::loadFromFile(const std::string& filename,
         deserializeField(userField, state.userFieldData, userShips);
         deserializeField(computerField, state.computerFieldData, computerShips);
         deserializeAbilities(abilities, state.abilitiesData);
+        deserializeKnowledge(userKnowledge, state.userKnowledgeData, computerField);
+        deserializeKnowledge(computerKnowledge, state.computerKnowledgeData, userField);
     } catch (const std::exception& e) {
         throw std::runtime_error(std::string("Error loading game state: ") + e.what());
     }
 }
 
+FleetDescriptor GameState::readFleet(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open file for loading: " + filename);
+    }
+
+    int width, height;
+    if (!(in >> width >> height)) {
+        throw std::runtime_error("Error reading dimensions");
+    }
+    return readFleetData(in);
+}
+
+FleetDescriptor GameState::readFleetData(std::istream& in) {
+    in >> std::ws;
+    if (in.peek() != 'f') {
+        return FleetDescriptor();
+    }
+
+    std::string tag, text;
+    if (!(in >> tag >> text) || tag != "fleet") {
+        throw std::runtime_error("Error reading fleet");
+    }
+    return FleetDescriptor::parse(text);
+}
+
 FieldData GameState::serializeField(const GameField& field) {
     FieldData data;
-    data.cells.resize(GameField::DEFAULT_HEIGHT, 
-                     std::vector<CellStatus>(GameField::DEFAULT_WIDTH));
+    data.width = field.getWidth();
+    data.height = field.getHeight();
+    data.cells.resize(static_cast<size_t>(data.width) * data.height);
 
-    for (int y = 0; y < GameField::DEFAULT_HEIGHT; ++y) {
-        for (int x = 0; x < GameField::DEFAULT_WIDTH; ++x) {
-            data.cells[y][x] = field.getCellStatus(x, y);
+    for (int y = 0; y < data.height; ++y) {
+        for (int x = 0; x < data.width; ++x) {
+            data.cells[static_cast<size_t>(y) * data.width + x] = field.getCellStatus(x, y);
         }
     }
 
-    for (int y = 0; y < GameField::DEFAULT_HEIGHT; ++y) {
-        for (int x = 0; x < GameField::DEFAULT_WIDTH; ++x) {
+    for (int y = 0; y < data.height; ++y) {
+        for (int x = 0; x < data.width; ++x) {
             Ship* ship = field.getShipAt(x, y);
             if (ship && field.getSegmentIndexAt(x, y) == 0) {
                 ShipData shipData;
@@ -126,7 +173,7 @@ FieldData GameState::serializeField(const GameField& field) {
 }
 
 void GameState::deserializeField(GameField& field, const FieldData& data, ShipManager& shipManager) {
-    field = GameField();
+    field = GameField(data.width, data.height);
 
     std::vector<size_t> shipIndices(data.ships.size());
     for (size_t i = 0; i < shipIndices.size(); ++i) {
@@ -168,16 +215,17 @@ void GameState::deserializeField(GameField& field, const FieldData& data, ShipMa
 
             field.placeShip(ship, x, y, orientation);
             shipUsed[shipIndex] = true;
+            int shipId = field.getShipCount() - 1;
 
             for (int j = 0; j < ship->getLength(); ++j) {
                 if (j < static_cast<int>(shipData.segmentStatus.size())) {
                     SegmentStatus savedStatus = shipData.segmentStatus[j];
                     switch(savedStatus) {
                         case SegmentStatus::Damaged:
-                            ship->applyDamage(j, 1);
+                            field.damageShipSegment(shipId, j, 1);
                             break;
                         case SegmentStatus::Destroyed:
-                            ship->applyDamage(j, 2);
+                            field.damageShipSegment(shipId, j, 2);
                             break;
                         default:
                             break;
@@ -192,39 +240,66 @@ void GameState::deserializeField(GameField& field, const FieldData& data, ShipMa
         }
     }
 
-    for (int y = 0; y < GameField::DEFAULT_HEIGHT; ++y) {
-        for (int x = 0; x < GameField::DEFAULT_WIDTH; ++x) {
-            if (field.getShipAt(x, y) == nullptr && 
-                y < static_cast<int>(data.cells.size()) && 
-                x < static_cast<int>(data.cells[y].size())) {
-                field.setCellStatus(x, y, data.cells[y][x]);
+    for (int y = 0; y < data.height; ++y) {
+        for (int x = 0; x < data.width; ++x) {
+            size_t index = static_cast<size_t>(y) * data.width + x;
+            if (field.getShipAt(x, y) == nullptr && index < data.cells.size()) {
+                if (data.cells[index] == CellStatus::Ship) {
+                    throw std::runtime_error("Ship cell without a ship in save file");
+                }
+                field.setCellStatus(x, y, data.cells[index]);
             }
         }
     }
 }
 
+KnowledgeData GameState::serializeKnowledge(const KnowledgeBoard& knowledge) {
+    KnowledgeData data;
+    data.present = true;
+    data.cells.reserve(static_cast<size_t>(knowledge.getWidth()) * knowledge.getHeight());
+
+    for (int y = 0; y < knowledge.getHeight(); ++y) {
+        for (int x = 0; x < knowledge.getWidth(); ++x) {
+            data.cells.push_back(knowledge.at(x, y));
+        }
+    }
+    return data;
+}
+
+void GameState::deserializeKnowledge(KnowledgeBoard& knowledge, const KnowledgeData& data, const GameField& field) {
+    if (!data.present) {
+        knowledge = KnowledgeBoard::fromField(field);
+        return;
+    }
+
+    knowledge = KnowledgeBoard(field.getWidth(), field.getHeight());
+    for (int y = 0; y < knowledge.getHeight(); ++y) {
+        for (int x = 0; x < knowledge.getWidth(); ++x) {
+            knowledge.set(x, y, data.cells[static_cast<size_t>(y) * knowledge.getWidth() + x]);
+        }
+    }
+}
+
 AbilitiesData GameState::serializeAbilities(const AbilityManager& manager) {
     AbilitiesData data;
-    std::vector<int> counts = manager.getAbilityCounts();
-    data.doubleDamageCount = counts[0];
-    data.scannerCount = counts[1];
-    data.barrageCount = counts[2];
+    data.queue.reserve(manager.size());
+    for (size_t i = 0; i < manager.size(); ++i) {
+        data.queue.push_back(manager.at(i));
+    }
     return data;
 }
 
 void GameState::deserializeAbilities(AbilityManager& manager, const AbilitiesData& data) {
-    std::vector<int> counts = {
-        data.doubleDamageCount,
-        data.scannerCount,
-        data.barrageCount
-    };
-    manager.setAbilitiesFromCounts(counts);
+    manager.clear();
+    for (AbilityType type : data.queue) {
+        manager.addAbility(type);
+    }
 }
 
 void GameState::writeFieldData(std::ostream& out, const FieldData& data) {
-    for (const auto& row : data.cells) {
-        for (const auto& cell : row) {
-            out << static_cast<int>(cell) << ' ';
+    for (int y = 0; y < data.height; ++y) {
+        for (int x = 0; x < data.width; ++x) {
+            out << static_cast<int>(data.cells[static_cast<size_t>(y) * data.width + x]) << ' ';
         }
         out << '\n';
     }
@@ -246,20 +321,18 @@ void GameState::writeFieldData(std::ostream& out, const FieldData& data) {
     }
 }
 
-FieldData GameState::readFieldData(std::istream& in) {
+FieldData GameState::readFieldData(std::istream& in, int width, int height) {
     FieldData data;
-    
-    data.cells.resize(GameField::DEFAULT_HEIGHT, 
-                     std::vector<CellStatus>(GameField::DEFAULT_WIDTH));
+    data.width = width;
+    data.height = height;
+    data.cells.resize(static_cast<size_t>(width) * height);
                      
-    for (auto& row : data.cells) {
-        for (auto& cell : row) {
-            int status;
-            if (!(in >> status)) {
-                throw std::runtime_error("Error reading cell status");
-            }
-            cell = static_cast<CellStatus>(status);
+    for (auto& cell : data.cells) {
+        int status;
+        if (!(in >> status)) {
+            throw std::runtime_error("Error reading cell status");
         }
+        cell = static_cast<CellStatus>(status);
     }
     
     size_t shipCount;
@@ -294,18 +367,75 @@ FieldData GameState::readFieldData(std::istream& in) {
 }
 
 void GameState::writeAbilitiesData(std::ostream& out, const AbilitiesData& data) {
-    out << data.doubleDamageCount << ' '
-        << data.scannerCount << ' '
-        << data.barrageCount << '\n';
+    out << "abilities " << data.queue.size();
+    for (AbilityType type : data.queue) {
+        out << ' ' << static_cast<int>(type);
+    }
+    out << '\n';
 }
 
 AbilitiesData GameState::readAbilitiesData(std::istream& in) {
     AbilitiesData data;
-    if (!(in >> data.doubleDamageCount 
-           >> data.scannerCount 
-           >> data.barrageCount)) {
+    in >> std::ws;
+    if (in.peek() != 'a') {
+        AbilityManager::Counts counts;
+        if (!(in >> counts[0] >> counts[1] >> counts[2])) {
+            throw std::runtime_error("Error reading abilities data");
+        }
+        for (size_t type = 0; type < counts.size(); ++type) {
+            if (counts[type] < 0 || data.queue.size() + counts[type] > AbilityManager::CAPACITY) {
+                throw std::runtime_error("Invalid abilities data");
+            }
+            data.queue.insert(data.queue.end(), counts[type], static_cast<AbilityType>(type));
+        }
+        return data;
+    }
+
+    std::string tag;
+    size_t size;
+    if (!(in >> tag >> size) || tag != "abilities" || size > AbilityManager::CAPACITY) {
         throw std::runtime_error("Error reading abilities data");
     }
+
+    data.queue.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        int type;
+        if (!(in >> type) || type < 0 || type >= static_cast<int>(AbilityManager::TYPE_COUNT)) {
+            throw std::runtime_error("Invalid ability in save file");
+        }
+        data.queue.push_back(static_cast<AbilityType>(type));
+    }
     return data;
 }
 
+
+
+void GameState::writeKnowledgeData(std::ostream& out, const KnowledgeData& data, int width, int height) {
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            out << static_cast<int>(data.cells[static_cast<size_t>(y) * width + x]) << ' ';
+        }
+        out << '\n';
+    }
+}
+
+KnowledgeData GameState::readKnowledgeData(std::istream& in, int width, int height) {
+    KnowledgeData data;
+    int status;
+    if (!(in >> status)) {
+        return data;
+    }
+
+    data.present = true;
+    data.cells.resize(static_cast<size_t>(width) * height);
+    for (size_t i = 0; i < data.cells.size(); ++i) {
+        if (i > 0 && !(in >> status)) {
+            throw std::runtime_error("Error reading knowledge data");
+        }
+        if (status < static_cast<int>(Knowledge::Unknown) || status > static_cast<int>(Knowledge::Sunk)) {
+            throw std::runtime_error("Invalid knowledge state in save file");
+        }
+        data.cells[i] = static_cast<Knowledge>(status);
+    }
+    return data;
+}
\ No newline at end of file
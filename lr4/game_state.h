@@ -9,6 +9,8 @@
 #include "game_field.h"
 #include "ship_manager.h"
 #include "ability_manager.h"
+#include "fleet_descriptor.h"
+#include "knowledge_board.h"
 
 struct ShipData {
     int length;
@@ -17,16 +19,21 @@ struct ShipData {
 };
 
 struct FieldData {
-    std::vector<std::vector<CellStatus>> cells;
+    int width = GameField::DEFAULT_WIDTH;
+    int height = GameField::DEFAULT_HEIGHT;
+    std::vector<CellStatus> cells;
     std::vector<ShipData> ships;
     std::vector<std::pair<int, int>> shipPositions;
     std::vector<Orientation> shipOrientations;
 };
 
+struct KnowledgeData {
+    bool present = false;
+    std::vector<Knowledge> cells;
+};
+
 struct AbilitiesData {
-    int doubleDamageCount;
-    int scannerCount;
-    int barrageCount;
+    std::vector<AbilityType> queue;
 };
 
 class GameState {
@@ -35,9 +42,11 @@ public:
     friend std::istream& operator>>(std::istream& is, GameState& state);
 
     static void saveToFile(const std::string& filename, 
+                          const FleetDescriptor& fleet,
                           const GameField& userField, 
                           const GameField& computerField,
-
+                          const KnowledgeBoard& userKnowledge,
+                          const KnowledgeBoard& computerKnowledge,
                           const AbilityManager& abilities);
 
     static void loadFromFile(const std::string& filename,
@@ -45,22 +54,34 @@ public:
                            GameField& computerField,
                            ShipManager& userShips,
                            ShipManager& computerShips,
+                           KnowledgeBoard& userKnowledge,
+                           KnowledgeBoard& computerKnowledge,
                            AbilityManager& abilities);
 
+    static FleetDescriptor readFleet(const std::string& filename);
+
 private:
+    FleetDescriptor fleet;
     FieldData userFieldData;
     FieldData computerFieldData;
     AbilitiesData abilitiesData;
+    KnowledgeData userKnowledgeData;
+    KnowledgeData computerKnowledgeData;
 
     static FieldData serializeField(const GameField& field);
     static void deserializeField(GameField& field, const FieldData& data, ShipManager& shipManager);
+    static KnowledgeData serializeKnowledge(const KnowledgeBoard& knowledge);
+    static void deserializeKnowledge(KnowledgeBoard& knowledge, const KnowledgeData& data, const GameField& field);
     static AbilitiesData serializeAbilities(const AbilityManager& manager);
     static void deserializeAbilities(AbilityManager& manager, const AbilitiesData& data);
     
+    static FleetDescriptor readFleetData(std::istream& in);
     static void writeFieldData(std::ostream& out, const FieldData& data);
-    static FieldData readFieldData(std::istream& in);
+    static FieldData readFieldData(std::istream& in, int width, int height);
     static void writeAbilitiesData(std::ostream& out, const AbilitiesData& data);
     static AbilitiesData readAbilitiesData(std::istream& in);
+    static void writeKnowledgeData(std::ostream& out, const KnowledgeData& data, int width, int height);
+    static KnowledgeData readKnowledgeData(std::istream& in, int width, int height);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef INLINE_VECTOR_H
+#define INLINE_VECTOR_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+template<typename T, size_t N>
+class InlineVector
+{
+public:
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_t capacity() const { return heap.empty() ? N : heap.size(); }
+    bool isInline() const { return heap.empty(); }
+
+    T* data() { return heap.empty() ? local.data() : heap.data(); }
+    const T* data() const { return heap.empty() ? local.data() : heap.data(); }
+    T* begin() { return data(); }
+    T* end() { return data() + count; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + count; }
+
+    T& operator[](size_t index) { return data()[index]; }
+    const T& operator[](size_t index) const { return data()[index]; }
+    T& back() { return data()[count - 1]; }
+    const T& back() const { return data()[count - 1]; }
+
+    void clear() { count = 0; }
+    void pop_back() { --count; }
+
+    void push_back(T value)
+    {
+        reserve(count + 1);
+        data()[count++] = std::move(value);
+    }
+
+    void resize(size_t newSize, const T& value = T())
+    {
+        reserve(newSize);
+        if (newSize > count)
+            std::fill(data() + count, data() + newSize, value);
+        count = newSize;
+    }
+
+    void assign(size_t newSize, const T& value)
+    {
+        count = 0;
+        resize(newSize, value);
+    }
+
+    void reserve(size_t wanted)
+    {
+        if (wanted <= capacity())
+            return;
+
+        std::vector<T> grown(std::max(wanted, 2 * capacity()));
+        std::move(begin(), end(), grown.begin());
+        heap = std::move(grown);
+    }
+
+private:
+    std::array<T, N> local {};
+    std::vector<T> heap;
+    size_t count = 0;
+};
+
+#endif
@@ -0,0 +1,141 @@
+#include "knowledge_board.h"
+
+#include <stdexcept>
+
+#include "game_field.h"
+
+KnowledgeBoard::KnowledgeBoard(int width, int height, std::pmr::memory_resource* resource)
+    : width(width), height(height), valid(true), miss(0, resource), damaged(0, resource),
+      destroyed(0, resource), sunk(0, resource), scannedShip(0, resource), scannedEmpty(0, resource)
+{
+    if (width <= 0 || height <= 0 || width > MAX_WIDTH || height > MAX_HEIGHT)
+    {
+        valid = false;
+        this->width = GameField::DEFAULT_WIDTH;
+        this->height = GameField::DEFAULT_HEIGHT;
+    }
+
+    size_t cells = static_cast<size_t>(this->width) * this->height;
+    miss.resize(cells);
+    damaged.resize(cells);
+    destroyed.resize(cells);
+    sunk.resize(cells);
+    scannedShip.resize(cells);
+    scannedEmpty.resize(cells);
+}
+
+KnowledgeBoard::KnowledgeBoard(const KnowledgeBoard& other, std::pmr::memory_resource* resource)
+    : width(other.width), height(other.height), valid(other.valid), miss(other.miss, resource),
+      damaged(other.damaged, resource), destroyed(other.destroyed, resource), sunk(other.sunk, resource),
+      scannedShip(other.scannedShip, resource), scannedEmpty(other.scannedEmpty, resource)
+{
+}
+
+KnowledgeBoard KnowledgeBoard::fromField(const GameField& field)
+{
+    KnowledgeBoard knowledge(field.getWidth(), field.getHeight());
+
+    for (int y = 0; y < knowledge.height; ++y)
+    {
+        for (int x = 0; x < knowledge.width; ++x)
+        {
+            CellStatus status = field.getCellStatus(x, y);
+            if (status == CellStatus::Miss)
+            {
+                knowledge.set(x, y, Knowledge::Miss);
+                continue;
+            }
+
+            Ship* ship = field.getShipAt(x, y);
+            if (!ship)
+                continue;
+
+            if (ship->isSunk())
+            {
+                knowledge.set(x, y, Knowledge::Sunk);
+                continue;
+            }
+
+            SegmentStatus segment = ship->getSegmentStatus(field.getSegmentIndexAt(x, y));
+            if (segment == SegmentStatus::Destroyed)
+                knowledge.set(x, y, Knowledge::Destroyed);
+            else if (segment == SegmentStatus::Damaged)
+                knowledge.set(x, y, Knowledge::Damaged);
+        }
+    }
+    return knowledge;
+}
+
+bool KnowledgeBoard::isValidPosition(int x, int y) const
+{
+    return x >= 0 && x < width && y >= 0 && y < height;
+}
+
+Knowledge KnowledgeBoard::at(int x, int y) const
+{
+    if (!isValidPosition(x, y))
+        throw std::out_of_range("Cell position out of range.");
+
+    size_t index = cellIndex(x, y);
+    if (sunk.test(index))
+        return Knowledge::Sunk;
+    if (destroyed.test(index))
+        return Knowledge::Destroyed;
+    if (damaged.test(index))
+        return Knowledge::Damaged;
+    if (miss.test(index))
+        return Knowledge::Miss;
+    if (scannedShip.test(index))
+        return Knowledge::Ship;
+    if (scannedEmpty.test(index))
+        return Knowledge::Empty;
+    return Knowledge::Unknown;
+}
+
+bool KnowledgeBoard::isUnknown(int x, int y) const
+{
+    return at(x, y) == Knowledge::Unknown;
+}
+
+void KnowledgeBoard::clearCell(size_t index)
+{
+    miss.reset(index);
+    damaged.reset(index);
+    destroyed.reset(index);
+    sunk.reset(index);
+    scannedShip.reset(index);
+    scannedEmpty.reset(index);
+}
+
+void KnowledgeBoard::set(int x, int y, Knowledge knowledge)
+{
+    if (!isValidPosition(x, y))
+        throw std::out_of_range("Cell position out of range.");
+
+    size_t index = cellIndex(x, y);
+    clearCell(index);
+
+    switch (knowledge)
+    {
+        case Knowledge::Unknown:
+            break;
+        case Knowledge::Empty:
+            scannedEmpty.set(index);
+            break;
+        case Knowledge::Ship:
+            scannedShip.set(index);
+            break;
+        case Knowledge::Miss:
+            miss.set(index);
+            break;
+        case Knowledge::Damaged:
+            damaged.set(index);
+            break;
+        case Knowledge::Destroyed:
+            destroyed.set(index);
+            break;
+        case Knowledge::Sunk:
+            sunk.set(index);
+            break;
+    }
+}
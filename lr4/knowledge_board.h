@@ -0,0 +1,83 @@
+#ifndef KNOWLEDGE_BOARD_H
+#define KNOWLEDGE_BOARD_H
+
+#include <memory_resource>
+#include <vector>
+
+#include "bitboard.h"
+
+class GameField;
+
+enum class Knowledge
+{
+    Unknown,
+    Empty,
+    Ship,
+    Miss,
+    Damaged,
+    Destroyed,
+    Sunk
+};
+
+struct CellDelta
+{
+    int x;
+    int y;
+    Knowledge before;
+    Knowledge after;
+    int shipId;
+    bool sunk;
+};
+
+using CellChanges = std::vector<CellDelta>;
+
+class KnowledgeBoard
+{
+public:
+    static const int MAX_WIDTH = 1024;
+    static const int MAX_HEIGHT = 1024;
+
+    KnowledgeBoard(int width = 10, int height = 10,
+                   std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    KnowledgeBoard(const KnowledgeBoard& other, std::pmr::memory_resource* resource);
+    KnowledgeBoard(const KnowledgeBoard& other) = default;
+    KnowledgeBoard& operator=(const KnowledgeBoard& other) = default;
+    KnowledgeBoard(KnowledgeBoard&& other) = default;
+    KnowledgeBoard& operator=(KnowledgeBoard&& other) = default;
+
+    static KnowledgeBoard fromField(const GameField& field);
+
+    bool isValid() const { return valid; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    bool isValidPosition(int x, int y) const;
+
+    Knowledge at(int x, int y) const;
+    void set(int x, int y, Knowledge knowledge);
+    bool isUnknown(int x, int y) const;
+
+    void apply(const CellDelta& delta) { set(delta.x, delta.y, delta.after); }
+
+    const Bitboard& getMisses() const { return miss; }
+    const Bitboard& getDamaged() const { return damaged; }
+    const Bitboard& getDestroyed() const { return destroyed; }
+    const Bitboard& getSunk() const { return sunk; }
+    const Bitboard& getScannedShips() const { return scannedShip; }
+    const Bitboard& getScannedEmpty() const { return scannedEmpty; }
+
+private:
+    size_t cellIndex(int x, int y) const { return static_cast<size_t>(y) * width + x; }
+    void clearCell(size_t index);
+
+    int width;
+    int height;
+    bool valid;
+    Bitboard miss;
+    Bitboard damaged;
+    Bitboard destroyed;
+    Bitboard sunk;
+    Bitboard scannedShip;
+    Bitboard scannedEmpty;
+};
+
+#endif
@@ -0,0 +1,47 @@
+#include "live_segment_index.h"
+
+#include <stdexcept>
+
+void LiveSegmentIndex::add(int shipId, int segment)
+{
+    if (shipId < 0 || segment < 0 || segment >= SEGMENTS_PER_SHIP)
+        throw std::out_of_range("Segment reference out of range.");
+
+    uint32_t key = keyOf(shipId, segment);
+    if (key >= positions.size())
+        positions.resize(static_cast<size_t>(shipId + 1) * SEGMENTS_PER_SHIP, ABSENT);
+    if (positions[key] != ABSENT)
+        return;
+
+    positions[key] = static_cast<int32_t>(segments.size());
+    segments.push_back(key);
+}
+
+void LiveSegmentIndex::remove(int shipId, int segment)
+{
+    if (!contains(shipId, segment))
+        return;
+
+    uint32_t key = keyOf(shipId, segment);
+    int32_t position = positions[key];
+    uint32_t last = segments.back();
+    segments[position] = last;
+    positions[last] = position;
+    segments.pop_back();
+    positions[key] = ABSENT;
+}
+
+bool LiveSegmentIndex::contains(int shipId, int segment) const
+{
+    if (shipId < 0 || segment < 0 || segment >= SEGMENTS_PER_SHIP)
+        return false;
+
+    uint32_t key = keyOf(shipId, segment);
+    return key < positions.size() && positions[key] != ABSENT;
+}
+
+void LiveSegmentIndex::clear()
+{
+    segments.clear();
+    positions.clear();
+}
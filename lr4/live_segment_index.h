@@ -0,0 +1,46 @@
+#ifndef LIVE_SEGMENT_INDEX_H
+#define LIVE_SEGMENT_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "board_storage.h"
+#include "inline_vector.h"
+
+struct SegmentRef
+{
+    int shipId;
+    int segment;
+};
+
+class LiveSegmentIndex
+{
+public:
+    static constexpr int SEGMENTS_PER_SHIP = 32;
+
+    void add(int shipId, int segment);
+    void remove(int shipId, int segment);
+    bool contains(int shipId, int segment) const;
+    void clear();
+
+    bool empty() const { return segments.empty(); }
+    size_t size() const { return segments.size(); }
+    SegmentRef at(size_t position) const
+    {
+        uint32_t key = segments[position];
+        return {static_cast<int>(key / SEGMENTS_PER_SHIP), static_cast<int>(key % SEGMENTS_PER_SHIP)};
+    }
+
+private:
+    static constexpr int32_t ABSENT = -1;
+
+    static uint32_t keyOf(int shipId, int segment)
+    {
+        return static_cast<uint32_t>(shipId) * SEGMENTS_PER_SHIP + static_cast<uint32_t>(segment);
+    }
+
+    InlineVector<uint32_t, StandardBoard::CELLS> segments;
+    InlineVector<int32_t, StandardBoard::MAX_SHIPS * SEGMENTS_PER_SHIP> positions;
+};
+
+#endif
@@ -4,10 +4,73 @@
 #include "game_display_impl.h"  
 #include "terminal_input.h"
 #include "terminal_renderer.h"
+#include <iostream>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 
-int main() {
-    auto game = std::make_shared<Game>();
+namespace {
+
+bool parseSize(const std::string& text, int& width, int& height) {
+    std::istringstream in(text);
+    char separator = 0;
+    if (!(in >> width >> separator >> height) || (separator != 'x' && separator != 'X') || !(in >> std::ws).eof()) {
+        return false;
+    }
+    return width > 0 && height > 0 && width <= GameField::MAX_WIDTH && height <= GameField::MAX_HEIGHT;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    GameMode mode = GameMode::Classic;
+    FleetDescriptor fleet;
+    uint64_t seed = GameRng::randomSeed();
+    bool reproducible = false;
+    ComputerStrategy strategy = ComputerStrategy::Density;
+    int width = GameField::DEFAULT_WIDTH;
+    int height = GameField::DEFAULT_HEIGHT;
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument == "--salvo") {
+            mode = GameMode::Salvo;
+        } else if (argument.rfind("--fleet=", 0) == 0) {
+            fleet = FleetDescriptor::parse(argument.substr(8));
+            if (!fleet.isValid()) {
+                std::cerr << "Некорректный состав флота: " << argument.substr(8) << "\n";
+                return 1;
+            }
+        } else if (argument.rfind("--seed=", 0) == 0) {
+            try {
+                seed = std::stoull(argument.substr(7));
+                reproducible = true;
+            } catch (const std::exception&) {
+                std::cerr << "Некорректное зерно генератора: " << argument.substr(7) << "\n";
+                return 1;
+            }
+        } else if (argument.rfind("--size=", 0) == 0) {
+            if (!parseSize(argument.substr(7), width, height)) {
+                std::cerr << "Некорректный размер поля: " << argument.substr(7) << "\n";
+                return 1;
+            }
+        } else if (argument == "--ai=density") {
+            strategy = ComputerStrategy::Density;
+        } else if (argument == "--ai=montecarlo") {
+            strategy = ComputerStrategy::MonteCarlo;
+        } else if (argument.rfind("--ai=", 0) == 0) {
+            std::cerr << "Неизвестная стратегия компьютера: " << argument.substr(5) << "\n";
+            return 1;
+        }
+    }
+
+    if (!fleet.fitsOn(width, height)) {
+        std::cerr << "Флот не помещается на поле " << width << "x" << height << ".\n";
+        return 1;
+    }
+
+    auto game = std::make_shared<Game>(width, height, mode, fleet,
+                                       GameArena::DEFAULT_CAPACITY, seed, strategy, reproducible);
     auto display = std::make_shared<GameDisplay<TerminalRenderer>>(game);
     game->registerObserver(display.get());
     auto handler = std::make_shared<DefaultCommandHandler>(display);
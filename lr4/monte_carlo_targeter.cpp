@@ -0,0 +1,104 @@
+#include "monte_carlo_targeter.h"
+
+#include <algorithm>
+
+namespace
+{
+uint64_t fingerprintOf(const KnowledgeBoard& knowledge)
+{
+    uint64_t hash = (static_cast<uint64_t>(knowledge.getWidth()) << 32) | static_cast<uint32_t>(knowledge.getHeight());
+    for (const Bitboard* bits : {&knowledge.getMisses(), &knowledge.getDamaged(), &knowledge.getDestroyed(),
+                                 &knowledge.getSunk(), &knowledge.getScannedShips(), &knowledge.getScannedEmpty()})
+    {
+        for (uint64_t word : bits->data())
+        {
+            hash = (hash ^ word) * 0x9E3779B97F4A7C15ull;
+            hash ^= hash >> 29;
+        }
+    }
+    return hash;
+}
+}
+
+MonteCarloTargeter::MonteCarloTargeter(uint64_t seed, unsigned workerCount, std::chrono::milliseconds budget,
+                                       SampleBudget sampleBudget)
+    : seed(seed), budget(budget), sampleBudget(sampleBudget),
+      workers(sampleBudget == SampleBudget::Fixed ? FIXED_STREAMS : std::max(workerCount, 1u)),
+      workerPool(workerCount)
+{
+    for (unsigned worker = 0; worker < workers.size(); ++worker)
+        workers[worker].rng = GameRng(seed, streamOf(worker));
+}
+
+void MonteCarloTargeter::update(const KnowledgeBoard& knowledge, const FleetDescriptor& fleet,
+                                const std::atomic<bool>* cancelled)
+{
+    prepared.prepare(knowledge, fleet);
+    auto deadline = std::chrono::steady_clock::time_point::max();
+    if (sampleBudget == SampleBudget::Fixed)
+    {
+        uint64_t position = fingerprintOf(knowledge);
+        for (unsigned worker = 0; worker < workers.size(); ++worker)
+            workers[worker].rng = GameRng(seed ^ position, streamOf(worker));
+    }
+    else
+    {
+        deadline = std::chrono::steady_clock::now() + budget;
+    }
+
+    unsigned threads = workerPool.size();
+    workerPool.run([&](unsigned thread) {
+        for (size_t worker = thread; worker < workers.size(); worker += threads)
+            sampleOn(workers[worker], deadline, cancelled);
+    });
+
+    hits.assign(prepared.getCellCount(), 0);
+    samples = 0;
+    attempts = 0;
+    for (const Worker& worker : workers)
+    {
+        samples += worker.samples;
+        attempts += worker.attempts;
+        for (size_t cell = 0; cell < hits.size(); ++cell)
+            hits[cell] += worker.hits[cell];
+    }
+}
+
+void MonteCarloTargeter::sampleOn(Worker& worker, std::chrono::steady_clock::time_point deadline,
+                                  const std::atomic<bool>* cancelled) const
+{
+    worker.sampler = prepared;
+    worker.hits.assign(prepared.getCellCount(), 0);
+    worker.samples = 0;
+    worker.attempts = 0;
+
+    bool fixed = sampleBudget == SampleBudget::Fixed;
+    const int maxSamples = fixed ? FIXED_SAMPLES_PER_STREAM : SAMPLES_PER_WORKER;
+    const int maxAttempts = fixed ? FIXED_ATTEMPTS_PER_STREAM : SAMPLES_PER_WORKER * ATTEMPTS_PER_SAMPLE;
+    while (worker.samples < maxSamples && worker.attempts < maxAttempts)
+    {
+        if (worker.attempts % CLOCK_CHECK_INTERVAL == 0)
+        {
+            if (std::chrono::steady_clock::now() >= deadline || (cancelled && cancelled->load()))
+                break;
+        }
+
+        ++worker.attempts;
+        if (!worker.sampler.sample(worker.rng))
+            continue;
+
+        ++worker.samples;
+        const std::vector<FleetSampler::Placement>& chosen = worker.sampler.getChosen();
+        const std::vector<int>& lengths = worker.sampler.getRemainingLengths();
+        for (size_t ship = 0; ship < chosen.size(); ++ship)
+        {
+            for (int k = 0; k < lengths[ship]; ++k)
+                ++worker.hits[chosen[ship].index + k * chosen[ship].step];
+        }
+    }
+}
+
+uint64_t MonteCarloTargeter::streamOf(unsigned worker)
+{
+    return static_cast<uint64_t>(RngStream::MonteCarlo) | (static_cast<uint64_t>(worker) << 32);
+}
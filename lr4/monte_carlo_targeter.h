@@ -0,0 +1,70 @@
+#ifndef MONTE_CARLO_TARGETER_H
+#define MONTE_CARLO_TARGETER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "fleet_descriptor.h"
+#include "fleet_sampler.h"
+#include "game_rng.h"
+#include "knowledge_board.h"
+#include "worker_pool.h"
+
+enum class SampleBudget
+{
+    Timed,
+    Fixed
+};
+
+class MonteCarloTargeter
+{
+public:
+    static constexpr int SAMPLES_PER_WORKER = 4096;
+    static constexpr int ATTEMPTS_PER_SAMPLE = 16;
+    static constexpr int CLOCK_CHECK_INTERVAL = 64;
+    static constexpr int DEFAULT_BUDGET_MS = 50;
+    static constexpr unsigned FIXED_STREAMS = 4;
+    static constexpr int FIXED_SAMPLES_PER_STREAM = 1024;
+    static constexpr int FIXED_ATTEMPTS_PER_STREAM = 16384;
+
+    explicit MonteCarloTargeter(uint64_t seed, unsigned workerCount = WorkerPool::defaultWorkers(),
+                                std::chrono::milliseconds budget = std::chrono::milliseconds(DEFAULT_BUDGET_MS),
+                                SampleBudget sampleBudget = SampleBudget::Timed);
+
+    void update(const KnowledgeBoard& knowledge, const FleetDescriptor& fleet,
+                const std::atomic<bool>* cancelled = nullptr);
+
+    unsigned getWorkers() const { return workerPool.size(); }
+    int getSamples() const { return samples; }
+    int getAttempts() const { return attempts; }
+    uint32_t hitsAt(size_t cell) const { return hits[cell]; }
+
+private:
+    struct alignas(64) Worker
+    {
+        GameRng rng;
+        FleetSampler sampler;
+        std::vector<uint32_t> hits;
+        int samples = 0;
+        int attempts = 0;
+    };
+
+    void sampleOn(Worker& worker, std::chrono::steady_clock::time_point deadline,
+                  const std::atomic<bool>* cancelled) const;
+    static uint64_t streamOf(unsigned worker);
+
+    uint64_t seed;
+    std::chrono::milliseconds budget;
+    SampleBudget sampleBudget;
+    FleetSampler prepared;
+    std::vector<Worker> workers;
+    std::vector<uint32_t> hits;
+    int samples = 0;
+    int attempts = 0;
+    WorkerPool workerPool;
+};
+
+#endif
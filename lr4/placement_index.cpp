@@ -0,0 +1,235 @@
+#include "placement_index.h"
+
+#include <algorithm>
+
+namespace
+{
+uint16_t originsCovering(int position, int extent, int length)
+{
+    int first = std::max(position - length + 1, 0);
+    int last = std::min(position, extent - length);
+    return last < first ? 0 : static_cast<uint16_t>(last - first + 1);
+}
+}
+
+void PlacementIndex::reset(int width, int height, const std::vector<ShipClass>& classes)
+{
+    clear();
+    this->width = width;
+    this->height = height;
+    size_t cellCount = static_cast<size_t>(width) * height;
+    blocked.assign(cellCount, 0);
+    hits.assign(cellCount, 0);
+
+    for (const ShipClass& shipClass : classes)
+    {
+        int length = shipClass.length;
+        if (length <= 0 || shipClass.count <= 0)
+            continue;
+
+        if (length >= static_cast<int>(trackByLength.size()))
+            trackByLength.resize(length + 1, -1);
+        if (trackByLength[length] >= 0)
+        {
+            tracks[trackByLength[length]].remaining += shipClass.count;
+            continue;
+        }
+
+        tracks.push_back(Track {length, shipClass.count, 0, {}, {}});
+        Track& track = tracks.back();
+        track.blockers.assign(2 * cellCount, OUT_OF_BOUNDS);
+        track.coverage.assign(cellCount, 0);
+        for (Orientation orientation : {Orientation::Horizontal, Orientation::Vertical})
+        {
+            if (orientation == Orientation::Vertical && length == 1)
+                break;
+
+            int spanX = orientation == Orientation::Horizontal ? length : 1;
+            int spanY = orientation == Orientation::Horizontal ? 1 : length;
+            for (int y = 0; y + spanY <= height; ++y)
+            {
+                for (int x = 0; x + spanX <= width; ++x)
+                {
+                    track.blockers[placementSlot(orientation, cellIndex(x, y))] = 0;
+                    ++track.consistent;
+                }
+            }
+        }
+
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                uint16_t vertical = length == 1 ? 0 : originsCovering(y, height, length);
+                track.coverage[cellIndex(x, y)] = static_cast<uint16_t>(originsCovering(x, width, length) + vertical);
+            }
+        }
+
+        trackByLength[length] = static_cast<int>(tracks.size()) - 1;
+    }
+}
+
+void PlacementIndex::clear()
+{
+    width = 0;
+    height = 0;
+    trackByLength.clear();
+    tracks.clear();
+    blocked.clear();
+    hits.clear();
+}
+
+void PlacementIndex::observe(int x, int y, Knowledge knowledge)
+{
+    if (!isTracking() || !isInside(x, y))
+        return;
+
+    switch (knowledge)
+    {
+        case Knowledge::Miss:
+        case Knowledge::Empty:
+            block(x, y);
+            break;
+        case Knowledge::Sunk:
+            for (int ny = std::max(y - 1, 0); ny <= std::min(y + 1, height - 1); ++ny)
+            {
+                for (int nx = std::max(x - 1, 0); nx <= std::min(x + 1, width - 1); ++nx)
+                    block(nx, ny);
+            }
+            break;
+        case Knowledge::Ship:
+        case Knowledge::Damaged:
+        case Knowledge::Destroyed:
+            if (hits[cellIndex(x, y)])
+                break;
+            hits[cellIndex(x, y)] = 1;
+            for (int ny : {y - 1, y + 1})
+            {
+                for (int nx : {x - 1, x + 1})
+                {
+                    if (isInside(nx, ny) && !hits[cellIndex(nx, ny)])
+                        block(nx, ny);
+                }
+            }
+            blockTouching(x, y);
+            break;
+        case Knowledge::Unknown:
+            break;
+    }
+}
+
+void PlacementIndex::recordSunk(int length)
+{
+    if (length < 0 || length >= static_cast<int>(trackByLength.size()) || trackByLength[length] < 0)
+        return;
+
+    Track& track = tracks[trackByLength[length]];
+    if (track.remaining > 0)
+        --track.remaining;
+}
+
+uint32_t PlacementIndex::coverage(int length, int x, int y) const
+{
+    const Track* track = trackFor(length);
+    return track && isInside(x, y) ? track->coverage[cellIndex(x, y)] : 0;
+}
+
+uint64_t PlacementIndex::placementCount(int length) const
+{
+    const Track* track = trackFor(length);
+    return track ? track->consistent : 0;
+}
+
+int PlacementIndex::remainingShips(int length) const
+{
+    const Track* track = trackFor(length);
+    return track ? track->remaining : 0;
+}
+
+bool PlacementIndex::isConsistent(int length, int x, int y, Orientation orientation) const
+{
+    const Track* track = trackFor(length);
+    if (!track || !isInside(x, y))
+        return false;
+
+    if (length == 1)
+        orientation = Orientation::Horizontal;
+    return track->blockers[placementSlot(orientation, cellIndex(x, y))] == 0;
+}
+
+const PlacementIndex::Track* PlacementIndex::trackFor(int length) const
+{
+    if (length < 0 || length >= static_cast<int>(trackByLength.size()) || trackByLength[length] < 0)
+        return nullptr;
+    return &tracks[trackByLength[length]];
+}
+
+size_t PlacementIndex::placementSlot(Orientation orientation, size_t origin) const
+{
+    return orientation == Orientation::Vertical ? blocked.size() + origin : origin;
+}
+
+void PlacementIndex::block(int x, int y)
+{
+    size_t cell = cellIndex(x, y);
+    if (blocked[cell])
+        return;
+    blocked[cell] = 1;
+
+    for (Track& track : tracks)
+    {
+        int length = track.length;
+        for (int originX = std::max(x - length + 1, 0); originX <= std::min(x, width - length); ++originX)
+            addBlocker(track, Orientation::Horizontal, originX, y);
+
+        if (length == 1)
+            continue;
+        for (int originY = std::max(y - length + 1, 0); originY <= std::min(y, height - length); ++originY)
+            addBlocker(track, Orientation::Vertical, x, originY);
+    }
+}
+
+void PlacementIndex::blockTouching(int x, int y)
+{
+    for (Track& track : tracks)
+    {
+        int length = track.length;
+        if (x - length >= 0)
+            addBlocker(track, Orientation::Horizontal, x - length, y);
+        if (x + 1 <= width - length)
+            addBlocker(track, Orientation::Horizontal, x + 1, y);
+        for (int ny : {y - 1, y + 1})
+        {
+            if (ny < 0 || ny >= height)
+                continue;
+            for (int originX = std::max(x - length + 1, 0); originX <= std::min(x, width - length); ++originX)
+                addBlocker(track, Orientation::Horizontal, originX, ny);
+        }
+
+        if (length == 1)
+            continue;
+        if (y - length >= 0)
+            addBlocker(track, Orientation::Vertical, x, y - length);
+        if (y + 1 <= height - length)
+            addBlocker(track, Orientation::Vertical, x, y + 1);
+        for (int nx : {x - 1, x + 1})
+        {
+            if (nx < 0 || nx >= width)
+                continue;
+            for (int originY = std::max(y - length + 1, 0); originY <= std::min(y, height - length); ++originY)
+                addBlocker(track, Orientation::Vertical, nx, originY);
+        }
+    }
+}
+
+void PlacementIndex::addBlocker(Track& track, Orientation orientation, int x, int y)
+{
+    size_t origin = cellIndex(x, y);
+    if (track.blockers[placementSlot(orientation, origin)]++ != 0)
+        return;
+
+    --track.consistent;
+    size_t step = orientation == Orientation::Horizontal ? 1 : static_cast<size_t>(width);
+    for (int k = 0; k < track.length; ++k)
+        --track.coverage[origin + k * step];
+}
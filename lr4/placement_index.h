@@ -0,0 +1,65 @@
+#ifndef PLACEMENT_INDEX_H
+#define PLACEMENT_INDEX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "board_storage.h"
+#include "fleet_descriptor.h"
+#include "inline_vector.h"
+#include "knowledge_board.h"
+#include "ship.h"
+
+class PlacementIndex
+{
+public:
+    void reset(int width, int height, const std::vector<ShipClass>& classes);
+    void clear();
+
+    void observe(int x, int y, Knowledge knowledge);
+    void recordSunk(int length);
+
+    bool isTracking() const { return !tracks.empty(); }
+    bool tracksLength(int length) const { return trackFor(length) != nullptr; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+    uint32_t coverage(int length, int x, int y) const;
+    uint64_t placementCount(int length) const;
+    int remainingShips(int length) const;
+    bool isConsistent(int length, int x, int y, Orientation orientation) const;
+
+private:
+    static constexpr uint16_t OUT_OF_BOUNDS = UINT16_MAX;
+    static constexpr size_t INLINE_CELLS = StandardBoard::CELLS;
+    static constexpr size_t INLINE_LENGTHS = std::max(StandardBoard::WIDTH, StandardBoard::HEIGHT);
+
+    struct Track
+    {
+        int length;
+        int remaining;
+        uint64_t consistent;
+        InlineVector<uint16_t, 2 * INLINE_CELLS> blockers;
+        InlineVector<uint16_t, INLINE_CELLS> coverage;
+    };
+
+    const Track* trackFor(int length) const;
+    bool isInside(int x, int y) const { return x >= 0 && y >= 0 && x < width && y < height; }
+    size_t cellIndex(int x, int y) const { return static_cast<size_t>(y) * width + x; }
+    size_t placementSlot(Orientation orientation, size_t origin) const;
+
+    void block(int x, int y);
+    void blockTouching(int x, int y);
+    void addBlocker(Track& track, Orientation orientation, int x, int y);
+
+    int width = 0;
+    int height = 0;
+    InlineVector<int, INLINE_LENGTHS + 1> trackByLength;
+    InlineVector<Track, INLINE_LENGTHS> tracks;
+    InlineVector<uint8_t, INLINE_CELLS> blocked;
+    InlineVector<uint8_t, INLINE_CELLS> hits;
+};
+
+#endif
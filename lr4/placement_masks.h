@@ -0,0 +1,76 @@
+#ifndef PLACEMENT_MASKS_H
+#define PLACEMENT_MASKS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "ship.h"
+
+template<size_t Words>
+struct PlacementMask
+{
+    std::array<uint64_t, Words> footprint;
+    std::array<uint64_t, Words> halo;
+    bool fits;
+};
+
+template<int W, int H, int MaxLength>
+constexpr std::array<PlacementMask<(W * H + 63) / 64>, MaxLength * 2 * W * H> buildPlacementMasks()
+{
+    std::array<PlacementMask<(W * H + 63) / 64>, MaxLength * 2 * W * H> table {};
+
+    for (int length = 1; length <= MaxLength; ++length)
+    {
+        for (int vertical = 0; vertical <= 1; ++vertical)
+        {
+            for (int y = 0; y < H; ++y)
+            {
+                for (int x = 0; x < W; ++x)
+                {
+                    auto& entry = table[((length - 1) * 2 + vertical) * W * H + y * W + x];
+                    int endX = vertical ? x : x + length - 1;
+                    int endY = vertical ? y + length - 1 : y;
+                    entry.fits = endX < W && endY < H;
+                    if (!entry.fits)
+                        continue;
+
+                    for (int cy = y - 1; cy <= endY + 1; ++cy)
+                    {
+                        for (int cx = x - 1; cx <= endX + 1; ++cx)
+                        {
+                            if (cx < 0 || cx >= W || cy < 0 || cy >= H)
+                                continue;
+
+                            int index = cy * W + cx;
+                            uint64_t bit = uint64_t(1) << (index & 63);
+                            entry.halo[index >> 6] |= bit;
+                            if (cx >= x && cx <= endX && cy >= y && cy <= endY)
+                                entry.footprint[index >> 6] |= bit;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return table;
+}
+
+template<int W, int H, int MaxLength>
+class PlacementMasks
+{
+public:
+    static constexpr size_t WORDS = (W * H + 63) / 64;
+    using Entry = PlacementMask<WORDS>;
+
+    static constexpr const Entry& at(int length, Orientation orientation, int x, int y)
+    {
+        int vertical = (orientation == Orientation::Vertical) ? 1 : 0;
+        return table[((length - 1) * 2 + vertical) * W * H + y * W + x];
+    }
+
+private:
+    static constexpr std::array<Entry, MaxLength * 2 * W * H> table = buildPlacementMasks<W, H, MaxLength>();
+};
+
+#endif
@@ -0,0 +1,60 @@
+#include "ponderer.h"
+
+#include <utility>
+
+Ponderer::~Ponderer()
+{
+    cancel();
+}
+
+void Ponderer::start(uint64_t version, Job job)
+{
+    cancel();
+    cancelled.store(false);
+    runningVersion = version;
+    thread = std::thread([this, version, job = std::move(job)] {
+        std::vector<uint64_t> scores = job(cancelled);
+        if (cancelled.load())
+            return;
+
+        auto published = std::make_shared<const PonderResult>(PonderResult {version, std::move(scores)});
+        std::atomic_store(&result, std::move(published));
+    });
+}
+
+void Ponderer::cancel()
+{
+    if (!thread.joinable())
+        return;
+
+    cancelled.store(true);
+    thread.join();
+}
+
+bool Ponderer::covers(uint64_t version) const
+{
+    if (thread.joinable())
+        return runningVersion == version;
+
+    std::shared_ptr<const PonderResult> current = latest();
+    return current && current->version == version;
+}
+
+std::shared_ptr<const PonderResult> Ponderer::wait(uint64_t version)
+{
+    if (thread.joinable())
+    {
+        if (runningVersion == version)
+            thread.join();
+        else
+            cancel();
+    }
+
+    std::shared_ptr<const PonderResult> current = latest();
+    return current && current->version == version ? current : nullptr;
+}
+
+std::shared_ptr<const PonderResult> Ponderer::latest() const
+{
+    return std::atomic_load(&result);
+}
@@ -0,0 +1,42 @@
+#ifndef PONDERER_H
+#define PONDERER_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+struct PonderResult
+{
+    uint64_t version = 0;
+    std::vector<uint64_t> scores;
+};
+
+class Ponderer
+{
+public:
+    using Job = std::function<std::vector<uint64_t>(const std::atomic<bool>& cancelled)>;
+
+    Ponderer() = default;
+    ~Ponderer();
+
+    Ponderer(const Ponderer&) = delete;
+    Ponderer& operator=(const Ponderer&) = delete;
+
+    void start(uint64_t version, Job job);
+    void cancel();
+    bool covers(uint64_t version) const;
+
+    std::shared_ptr<const PonderResult> wait(uint64_t version);
+    std::shared_ptr<const PonderResult> latest() const;
+
+private:
+    std::thread thread;
+    std::atomic<bool> cancelled {false};
+    uint64_t runningVersion = 0;
+    std::shared_ptr<const PonderResult> result;
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include "scan_region.h"
+
+#include <algorithm>
+#include <limits>
+
+ScanRegion::ScanRegion(int x, int y, int width, int height) : x(x), y(y), width(width), height(height)
+{
+}
+
+ScanRegion ScanRegion::rectangle(int x, int y, int width, int height)
+{
+    return ScanRegion(x, y, width, height);
+}
+
+ScanRegion ScanRegion::row(int y)
+{
+    return ScanRegion(0, y, std::numeric_limits<int>::max(), 1);
+}
+
+ScanRegion ScanRegion::column(int x)
+{
+    return ScanRegion(x, 0, 1, std::numeric_limits<int>::max());
+}
+
+ScanRegion ScanRegion::mask(const Bitboard& cells)
+{
+    ScanRegion region(0, 0, std::numeric_limits<int>::max(), std::numeric_limits<int>::max());
+    region.masked = true;
+    region.cells = cells;
+    return region;
+}
+
+ScanRegion ScanRegion::boundsWithin(int boardWidth, int boardHeight) const
+{
+    long long left = std::max<long long>(x, 0);
+    long long top = std::max<long long>(y, 0);
+    long long right = std::min<long long>(static_cast<long long>(x) + width, boardWidth);
+    long long bottom = std::min<long long>(static_cast<long long>(y) + height, boardHeight);
+
+    return ScanRegion(static_cast<int>(left), static_cast<int>(top),
+                      static_cast<int>(std::max(right - left, 0LL)), static_cast<int>(std::max(bottom - top, 0LL)));
+}
+
+bool ScanResult::contains(int cellX, int cellY) const
+{
+    return cellX >= x && cellX < x + width && cellY >= y && cellY < y + height;
+}
+
+bool ScanResult::shipAt(int cellX, int cellY) const
+{
+    if (!hasCells || !contains(cellX, cellY))
+        return false;
+
+    return cells.test(static_cast<size_t>(cellY - y) * width + (cellX - x));
+}
@@ -0,0 +1,57 @@
+#ifndef SCAN_REGION_H
+#define SCAN_REGION_H
+
+#include "bitboard.h"
+
+enum class ScanOutput
+{
+    CountOnly,
+    WithCells
+};
+
+class ScanRegion
+{
+public:
+    static ScanRegion rectangle(int x, int y, int width, int height);
+    static ScanRegion row(int y);
+    static ScanRegion column(int x);
+    static ScanRegion mask(const Bitboard& cells);
+
+    bool isMask() const { return masked; }
+    bool isEmpty() const { return width <= 0 || height <= 0; }
+    int getX() const { return x; }
+    int getY() const { return y; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    const Bitboard& getMask() const { return cells; }
+
+    ScanRegion boundsWithin(int boardWidth, int boardHeight) const;
+
+private:
+    ScanRegion(int x, int y, int width, int height);
+
+    int x;
+    int y;
+    int width;
+    int height;
+    bool masked = false;
+    Bitboard cells;
+};
+
+// cells covers the clipped bounding rectangle row by row, so the cell at
+// board position (x + i, y + j) is bit j * width + i.
+struct ScanResult
+{
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+    int shipCells = 0;
+    bool hasCells = false;
+    Bitboard cells;
+
+    bool contains(int cellX, int cellY) const;
+    bool shipAt(int cellX, int cellY) const;
+};
+
+#endif
@@ -5,12 +5,17 @@
 
 class ScannerAbility : public Ability {
 public:
+    static constexpr int AREA_SIZE = 2;
+
+    ScannerAbility() : ScannerAbility(ScanRegion::rectangle(0, 0, AREA_SIZE, AREA_SIZE)) {}
+    explicit ScannerAbility(const ScanRegion& region) : region(region) {}
+
     void apply(GameField& field) override;
-    void setParameters() override;
     AbilityType getType() const override { return AbilityType::Scanner; }
+    const ScanResult& getResult() const { return result; }
 private:
-    int x = 0;
-    int y = 0;
+    ScanRegion region;
+    ScanResult result;
 };
 
 #endif
@@ -2,16 +2,21 @@
 
 #include <stdexcept>
 
+#include "fleet.h"
+
 Ship::Ship(int length, Orientation orientation)
-    : length(length), orientation(orientation), valid(true)
+    : ownedFleet(std::make_unique<Fleet>()), fleet(ownedFleet.get()), index(0), valid(true)
 {
     if (length < MIN_LENGTH || length > MAX_LENGTH)
     {
         valid = false;
-        this->length = 0;
+        length = 0;
     }
-    else
-        segmentDamages.resize(length, SegmentStatus::Intact);
+    index = fleet->addShip(length, orientation);
+}
+
+Ship::Ship(Fleet* fleet, int index) : fleet(fleet), index(index), valid(true)
+{
 }
 
 bool Ship::isValid() const
@@ -23,48 +28,35 @@ Ship::~Ship() = default;
 
 int Ship::getLength() const
 {
-    return length;
+    return fleet->getLength(index);
 }
 
 Orientation Ship::getOrientation() const
 {
-    return orientation;
+    return fleet->getOrientation(index);
 }
 
-SegmentStatus Ship::getSegmentStatus(int index) const
+void Ship::setOrientation(Orientation newOrientation)
 {
-    if (index < 0 || index >= length)
-        throw std::out_of_range("Segment index out of range.");
-
-    return segmentDamages[index];
+    fleet->setOrientation(index, newOrientation);
 }
 
-void Ship::applyDamage(int index, int damage)
+void Ship::setOrigin(int x, int y)
 {
-    if (index < 0 || index >= length)
-        throw std::out_of_range("Segment index out of range.");
-
-    if (damage < 0)
-        throw std::invalid_argument("Damage cannot be negative.");
+    fleet->setOrigin(index, x, y);
+}
 
-    int currentDamage = static_cast<int>(segmentDamages[index]) + damage;
+SegmentStatus Ship::getSegmentStatus(int segmentIndex) const
+{
+    return fleet->getSegmentStatus(index, segmentIndex);
+}
 
-    if (currentDamage >= static_cast<int>(SegmentStatus::Destroyed))
-    {
-        segmentDamages[index] = SegmentStatus::Destroyed;
-    }
-    else if (currentDamage >= static_cast<int>(SegmentStatus::Damaged))
-    {
-        segmentDamages[index] = SegmentStatus::Damaged;
-    }
+void Ship::applyDamage(int segmentIndex, int damage)
+{
+    fleet->applyDamage(index, segmentIndex, damage);
 }
 
 bool Ship::isSunk() const
 {
-    for (const auto& status : segmentDamages)
-    {
-        if (status != SegmentStatus::Destroyed)
-            return false;
-    }
-    return true;
+    return fleet->isSunk(index);
 }
@@ -3,7 +3,7 @@
 
 #include <sys/wait.h>
 
-#include <vector>
+#include <memory>
 
 enum class Orientation
 {
@@ -18,6 +18,8 @@ enum class SegmentStatus
     Destroyed
 };
 
+class Fleet;
+
 class Ship
 {
 public:
@@ -32,14 +34,20 @@ public:
     void applyDamage(int index, int damage);
     bool isSunk() const;
 
-    void setOrientation(Orientation newOrientation) { orientation = newOrientation; }
+    void setOrientation(Orientation newOrientation);
+    void setOrigin(int x, int y);
+    int getFleetIndex() const { return index; }
 
 private:
+    friend class ShipManager;
+
+    Ship(Fleet* fleet, int index);
+
     static const int MIN_LENGTH = 1;
-    static const int MAX_LENGTH = 4;
-    int length;
-    Orientation orientation;
-    std::vector<SegmentStatus> segmentDamages;
+    static const int MAX_LENGTH = 32;
+    std::unique_ptr<Fleet> ownedFleet;
+    Fleet* fleet;
+    int index;
 
     Ship(const Ship&) = delete;
     Ship& operator=(const Ship&) = delete;
@@ -1,37 +1,69 @@
 #include "ship_manager.h"
 
 #include <memory>
+#include <new>
 #include <stdexcept>
 
 #include "ship.h"
 
-ShipManager::ShipManager(const std::vector<int>& shipSizes) : shipsRemaining(0), valid(true)
+ShipManager::ShipManager(const std::vector<int>& shipSizes, std::pmr::memory_resource* resource)
+    : fleet(resource), ships(resource), valid(true)
 {
     for (int size : shipSizes)
     {
-        auto ship = std::make_unique<Ship>(size, Orientation::Horizontal);
-        if (!ship->isValid())
+        if (size < MIN_LENGTH || size > MAX_LENGTH)
         {
             valid = false;
             break;
         }
-        ships.push_back(std::move(ship));
-        shipSunkStatus.push_back(false);
-        shipsRemaining++;
+        ships.push_back(createHandle(fleet.addShip(size, Orientation::Horizontal)));
     }
 }
 
+ShipManager::ShipManager(const ShipManager& other, std::pmr::memory_resource* resource)
+    : fleet(resource), ships(resource), valid(other.valid)
+{
+    fleet = other.fleet;
+    for (size_t i = 0; i < other.ships.size(); ++i)
+        ships.push_back(createHandle(static_cast<int>(i)));
+}
+
+ShipManager::~ShipManager()
+{
+    std::pmr::polymorphic_allocator<Ship> allocator(ships.get_allocator());
+    for (Ship* ship : ships)
+    {
+        ship->~Ship();
+        allocator.deallocate(ship, 1);
+    }
+}
+
+Ship* ShipManager::createHandle(int index)
+{
+    std::pmr::polymorphic_allocator<Ship> allocator(ships.get_allocator());
+    Ship* ship = allocator.allocate(1);
+    return new (ship) Ship(&fleet, index);
+}
+
 bool ShipManager::isValid() const
 {
     return valid;
 }
 
+size_t ShipManager::indexOf(const Ship* ship) const
+{
+    if (!ship || ship->fleet != &fleet)
+        throw std::invalid_argument("Ship not found in manager.");
+
+    return static_cast<size_t>(ship->getFleetIndex());
+}
+
 Ship* ShipManager::getShip(size_t index) const
 {
     if (index >= ships.size())
         throw std::out_of_range("Ship index out of range.");
 
-    return ships[index].get();
+    return ships[index];
 }
 
 size_t ShipManager::getShipCount() const
@@ -44,27 +76,16 @@ void ShipManager::updateShip(Ship* ship)
     if (!ship)
         throw std::invalid_argument("Ship pointer is null.");
 
-    for (size_t i = 0; i < ships.size(); ++i)
-    {
-        if (ships[i].get() == ship)
-        {
-            if (!shipSunkStatus[i] && ship->isSunk())
-            {
-                shipSunkStatus[i] = true;
-                shipsRemaining--;
-            }
-            return;
-        }
-    }
-    throw std::invalid_argument("Ship not found in manager in manager.");
+    if (ship->fleet != &fleet)
+        throw std::invalid_argument("Ship not found in manager in manager.");
 }
 
 int ShipManager::getShipRemaining() const
 {
-    return shipsRemaining;
+    return fleet.getShipsRemaining();
 }
 
 bool ShipManager::areAllShipsSunk() const
 {
-    return shipsRemaining == 0;
+    return fleet.getShipsRemaining() == 0;
 }
@@ -2,30 +2,40 @@
 #define SHIP_MANAGER_H
 
 #include <memory>
+#include <memory_resource>
 #include <vector>
 
+#include "fleet.h"
 #include "ship.h"
 
 class ShipManager
 {
 public:
-    ShipManager(const std::vector<int>& shipSizes);
+    static const int MIN_LENGTH = 1;
+    static const int MAX_LENGTH = Fleet::MAX_SEGMENTS;
+
+    ShipManager(const std::vector<int>& shipSizes,
+                std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    ShipManager(const ShipManager& other, std::pmr::memory_resource* resource);
+    ~ShipManager();
 
     bool isValid() const;
 
     Ship* getShip(size_t index) const;
     size_t getShipCount() const;
+    size_t indexOf(const Ship* ship) const;
     void updateShip(Ship* ship);
 
     int getShipRemaining() const;
     bool areAllShipsSunk() const;
 
+    const Fleet& getFleet() const { return fleet; }
+
 private:
-    static const int MIN_LENGTH = 1;
-    static const int MAX_LENGTH = 4;
-    std::vector<std::unique_ptr<Ship>> ships;
-    std::vector<bool> shipSunkStatus;
-    int shipsRemaining;
+    Ship* createHandle(int index);
+
+    Fleet fleet;
+    std::pmr::vector<Ship*> ships;
 
     ShipManager(const ShipManager&) = delete;
     ShipManager& operator=(const ShipManager&) = delete;
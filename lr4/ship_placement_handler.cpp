@@ -6,6 +6,14 @@ void ShipPlacementHandler::placeUserShips(GameField& field, ShipManager& shipMan
     for (size_t i = 0; i < shipManager.getShipCount(); ++i) {
         Ship* ship = shipManager.getShip(i);
         bool placed = false;
+
+        if (!field.hasLegalPlacement(ship->getLength())) {
+            std::cout << "Для корабля длины " << ship->getLength()
+                      << " не осталось места. Расстановка начинается заново.\n";
+            field.clear();
+            i = static_cast<size_t>(-1);
+            continue;
+        }
         
         while (!placed) {
             observer.renderShipPlacement(ship->getLength(), i + 1);
@@ -13,7 +21,7 @@ void ShipPlacementHandler::placeUserShips(GameField& field, ShipManager& shipMan
 
             int x = 0, y = 0;
             char orientationChar = 0;
-            getPlacementCoordinates(x, y, orientationChar);
+            getPlacementCoordinates(field, x, y, orientationChar);
             
             try {
                 field.placeShip(ship, x, y, charToOrientation(orientationChar));
@@ -26,21 +34,21 @@ void ShipPlacementHandler::placeUserShips(GameField& field, ShipManager& shipMan
     }
 }
 
-void ShipPlacementHandler::getPlacementCoordinates(int& x, int& y, char& orientationChar) {
-    std::cout << "Введите координату X (0-" << GameField::DEFAULT_WIDTH - 1 << "): ";
-    while (!(std::cin >> x) || !validateCoordinates(x, GameField::DEFAULT_WIDTH)) {
+void ShipPlacementHandler::getPlacementCoordinates(const GameField& field, int& x, int& y, char& orientationChar) {
+    std::cout << "Введите координату X (0-" << field.getWidth() - 1 << "): ";
+    while (!(std::cin >> x) || !validateCoordinates(x, field.getWidth())) {
         std::cin.clear();
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         std::cout << "Пожалуйста, введите корректную координату X (0-" 
-                << GameField::DEFAULT_WIDTH - 1 << "): ";
+                << field.getWidth() - 1 << "): ";
     }
 
-    std::cout << "Введите координату Y (0-" << GameField::DEFAULT_HEIGHT - 1 << "): ";
-    while (!(std::cin >> y) || !validateCoordinates(y, GameField::DEFAULT_HEIGHT)) {
+    std::cout << "Введите координату Y (0-" << field.getHeight() - 1 << "): ";
+    while (!(std::cin >> y) || !validateCoordinates(y, field.getHeight())) {
         std::cin.clear();
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         std::cout << "Пожалуйста, введите корректную координату Y (0-" 
-                << GameField::DEFAULT_HEIGHT - 1 << "): ";
+                << field.getHeight() - 1 << "): ";
     }
 
     std::cout << "Введите ориентацию (H - горизонтально, V - вертикально): ";
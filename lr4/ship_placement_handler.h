@@ -10,7 +10,7 @@ public:
     static void placeUserShips(GameField& field, ShipManager& shipManager, IGameObserver& observer);
 
 private:
-    static void getPlacementCoordinates(int& x, int& y, char& orientationChar);
+    static void getPlacementCoordinates(const GameField& field, int& x, int& y, char& orientationChar);
     static bool validateCoordinates(int x, int y);
     static Orientation charToOrientation(char orientationChar);
 };
@@ -0,0 +1,133 @@
+#include "sparse_bitset.h"
+
+void SparseBitset::resize(size_t newBits)
+{
+    chunks.clear();
+    bits = newBits;
+}
+
+void SparseBitset::reset(size_t index)
+{
+    auto it = chunks.find(index / CHUNK_BITS);
+    if (it == chunks.end())
+        return;
+
+    it->second &= ~(uint64_t(1) << (index % CHUNK_BITS));
+    if (it->second == 0)
+        chunks.erase(it);
+}
+
+uint64_t SparseBitset::wordAt(size_t chunk) const
+{
+    auto it = chunks.find(chunk);
+    return it == chunks.end() ? 0 : it->second;
+}
+
+bool SparseBitset::anyInRange(size_t begin, size_t end) const
+{
+    if (begin >= end || chunks.empty())
+        return false;
+
+    size_t firstChunk = begin / CHUNK_BITS;
+    size_t lastChunk = (end - 1) / CHUNK_BITS;
+
+    if (lastChunk - firstChunk + 1 > chunks.size())
+    {
+        for (const auto& [chunk, word] : chunks)
+        {
+            if (chunk < firstChunk || chunk > lastChunk)
+                continue;
+            size_t low = (chunk == firstChunk) ? begin % CHUNK_BITS : 0;
+            size_t high = (chunk == lastChunk) ? (end - 1) % CHUNK_BITS + 1 : CHUNK_BITS;
+            if (word & bitRangeMask(low, high))
+                return true;
+        }
+        return false;
+    }
+
+    for (size_t chunk = firstChunk; chunk <= lastChunk; ++chunk)
+    {
+        size_t low = (chunk == firstChunk) ? begin % CHUNK_BITS : 0;
+        size_t high = (chunk == lastChunk) ? (end - 1) % CHUNK_BITS + 1 : CHUNK_BITS;
+        if (wordAt(chunk) & bitRangeMask(low, high))
+            return true;
+    }
+    return false;
+}
+
+void SparseBitset::setRange(size_t begin, size_t end)
+{
+    if (begin >= end)
+        return;
+
+    size_t firstChunk = begin / CHUNK_BITS;
+    size_t lastChunk = (end - 1) / CHUNK_BITS;
+
+    for (size_t chunk = firstChunk; chunk <= lastChunk; ++chunk)
+    {
+        size_t low = (chunk == firstChunk) ? begin % CHUNK_BITS : 0;
+        size_t high = (chunk == lastChunk) ? (end - 1) % CHUNK_BITS + 1 : CHUNK_BITS;
+        chunks[chunk] |= bitRangeMask(low, high);
+    }
+}
+
+size_t SparseBitset::count() const
+{
+    size_t total = 0;
+    for (const auto& entry : chunks)
+        total += static_cast<size_t>(__builtin_popcountll(entry.second));
+    return total;
+}
+
+size_t SparseBitset::countInRange(size_t begin, size_t end) const
+{
+    size_t total = 0;
+    forEachWordInRange(begin, end, [&](size_t, uint64_t word) {
+        total += static_cast<size_t>(__builtin_popcountll(word));
+    });
+    return total;
+}
+
+void SparseBitset::setMask(const SparseBitset& mask)
+{
+    for (const auto& [chunk, word] : mask.chunks)
+        chunks[chunk] |= word;
+}
+
+void SparseBitset::clearMask(const SparseBitset& mask)
+{
+    if (mask.chunks.size() > chunks.size())
+    {
+        for (auto it = chunks.begin(); it != chunks.end();)
+        {
+            it->second &= ~mask.wordAt(it->first);
+            if (it->second == 0)
+                it = chunks.erase(it);
+            else
+                ++it;
+        }
+        return;
+    }
+
+    for (const auto& [chunk, word] : mask.chunks)
+    {
+        auto it = chunks.find(chunk);
+        if (it == chunks.end())
+            continue;
+        it->second &= ~word;
+        if (it->second == 0)
+            chunks.erase(it);
+    }
+}
+
+void SparseBitset::keepMask(const SparseBitset& mask)
+{
+    for (auto it = chunks.begin(); it != chunks.end();)
+    {
+        it->second &= mask.wordAt(it->first);
+        if (it->second == 0)
+            it = chunks.erase(it);
+        else
+            ++it;
+    }
+}
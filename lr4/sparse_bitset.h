@@ -0,0 +1,113 @@
+#ifndef SPARSE_BITSET_H
+#define SPARSE_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+#include "bitboard.h"
+
+class SparseBitset
+{
+public:
+    static constexpr size_t CHUNK_BITS = 64;
+
+    size_t size() const { return bits; }
+    void resize(size_t newBits);
+    void clear() { chunks.clear(); }
+
+    bool test(size_t index) const
+    {
+        auto it = chunks.find(index / CHUNK_BITS);
+        return it != chunks.end() && ((it->second >> (index % CHUNK_BITS)) & 1u);
+    }
+    void set(size_t index) { chunks[index / CHUNK_BITS] |= uint64_t(1) << (index % CHUNK_BITS); }
+    void reset(size_t index);
+    uint64_t wordAt(size_t chunk) const;
+    void setBitsInWord(size_t chunk, uint64_t bits)
+    {
+        if (bits)
+            chunks[chunk] |= bits;
+    }
+
+    bool anyInRange(size_t begin, size_t end) const;
+    void setRange(size_t begin, size_t end);
+    size_t count() const;
+    size_t countInRange(size_t begin, size_t end) const;
+    size_t chunkCount() const { return chunks.size(); }
+
+    void setMask(const SparseBitset& mask);
+    void clearMask(const SparseBitset& mask);
+    void keepMask(const SparseBitset& mask);
+
+    template<typename Visitor>
+    void forEachChunk(Visitor visitor) const
+    {
+        for (const auto& [chunk, word] : chunks)
+            visitor(chunk, word);
+    }
+
+    template<typename Visitor>
+    void forEachWordInRange(size_t begin, size_t end, Visitor visitor) const
+    {
+        if (begin >= end || chunks.empty())
+            return;
+
+        size_t firstChunk = begin / CHUNK_BITS;
+        size_t lastChunk = (end - 1) / CHUNK_BITS;
+        bool scanChunks = lastChunk - firstChunk + 1 > chunks.size();
+
+        auto visitChunk = [&](size_t chunk, uint64_t word) {
+            size_t low = (chunk == firstChunk) ? begin % CHUNK_BITS : 0;
+            size_t high = (chunk == lastChunk) ? (end - 1) % CHUNK_BITS + 1 : CHUNK_BITS;
+            if (uint64_t masked = word & bitRangeMask(low, high))
+                visitor(chunk * CHUNK_BITS, masked);
+        };
+
+        if (scanChunks)
+        {
+            for (const auto& [chunk, word] : chunks)
+            {
+                if (chunk >= firstChunk && chunk <= lastChunk)
+                    visitChunk(chunk, word);
+            }
+            return;
+        }
+
+        for (size_t chunk = firstChunk; chunk <= lastChunk; ++chunk)
+            visitChunk(chunk, wordAt(chunk));
+    }
+
+    template<typename Visitor>
+    void forEachSetBit(Visitor visitor) const
+    {
+        for (const auto& [chunk, word] : chunks)
+        {
+            for (uint64_t bits = word; bits; bits &= bits - 1)
+                visitor(chunk * CHUNK_BITS + static_cast<size_t>(__builtin_ctzll(bits)));
+        }
+    }
+
+private:
+    std::unordered_map<uint64_t, uint64_t> chunks;
+    size_t bits = 0;
+};
+
+class SparseShipIds
+{
+public:
+    void assign(size_t /* cells */, int emptyId) { ids.clear(); empty = emptyId; }
+
+    int operator[](size_t index) const
+    {
+        auto it = ids.find(index);
+        return it == ids.end() ? empty : it->second;
+    }
+    int& operator[](size_t index) { return ids.try_emplace(index, empty).first->second; }
+
+private:
+    std::unordered_map<uint64_t, int> ids;
+    int empty = -1;
+};
+
+#endif
@@ -54,7 +54,8 @@ void TerminalInputProcessor::loadDefaultKeymap() {
         {'v', Command::SaveGame},
         {'l', Command::LoadGame},
         {'d', Command::DisplayFields},
-        {'q', Command::Quit}
+        {'q', Command::Quit},
+        {'h', Command::Hint}
     };
 }
 
@@ -147,6 +148,7 @@ Command TerminalInputProcessor::stringToCommand(const std::string& str) {
     if (upperStr == "LOAD") return Command::LoadGame;
     if (upperStr == "DISPLAY") return Command::DisplayFields;
     if (upperStr == "QUIT") return Command::Quit;
+    if (upperStr == "HINT") return Command::Hint;
     return Command::Invalid;
 }
 
@@ -164,6 +166,8 @@ std::string TerminalInputProcessor::commandToString(Command cmd) const {
             return "display";
         case Command::Quit:
             return "quit";
+        case Command::Hint:
+            return "hint";
         default:
             return "INVALID";
     }
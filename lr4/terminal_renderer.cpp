@@ -1,15 +1,17 @@
 #include "terminal_renderer.h"
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <string>
 
 void TerminalRenderer::renderUserField(const GameField& field) {
     std::cout << "\nВаше поле:\n";
-    renderField(field, false);
+    renderGrid(field.getWidth(), field.getHeight(), [&](int x, int y) { return getFieldSymbol(field, x, y); });
 }
 
-void TerminalRenderer::renderComputerField(const GameField& field) {
+void TerminalRenderer::renderComputerField(const KnowledgeBoard& knowledge) {
     std::cout << "\nПоле компьютера:\n";
-    renderField(field, true);
+    renderGrid(knowledge.getWidth(), knowledge.getHeight(), [&](int x, int y) { return getKnowledgeSymbol(knowledge, x, y); });
 }
 
 void TerminalRenderer::renderAbilityStatus(const AbilityManager& manager) {
@@ -52,85 +54,58 @@ void TerminalRenderer::renderAttackResult(int x, int y, bool isHit, bool isSunk,
     }
 }
 
-void TerminalRenderer::renderField(const GameField& field, bool isComputer) const {
-    std::cout << "   ";
-    for (int x = 0; x < GameField::DEFAULT_WIDTH; ++x) {
-        std::cout << x << " ";
+template<typename SymbolAt>
+void TerminalRenderer::renderGrid(int width, int height, SymbolAt symbolAt) const {
+    int columnWidth = static_cast<int>(std::to_string(width - 1).size());
+    int rowLabelWidth = std::max(2, static_cast<int>(std::to_string(height - 1).size()));
+
+    std::cout << std::string(rowLabelWidth + 1, ' ');
+    for (int x = 0; x < width; ++x) {
+        std::cout << std::left << std::setw(columnWidth) << x << std::right << " ";
     }
     std::cout << "\n";
 
-    for (int y = 0; y < GameField::DEFAULT_HEIGHT; ++y) {
-        std::cout << std::setw(2) << y << " ";
-        for (int x = 0; x < GameField::DEFAULT_WIDTH; ++x) {
-            char symbol = getFieldSymbol(field, x, y, isComputer);
-            std::cout << symbol << " ";
+    for (int y = 0; y < height; ++y) {
+        std::cout << std::setw(rowLabelWidth) << y << " ";
+        for (int x = 0; x < width; ++x) {
+            std::cout << std::left << std::setw(columnWidth) << symbolAt(x, y) << std::right << " ";
         }
         std::cout << "\n";
     }
     std::cout << "\n";
 }
 
-char TerminalRenderer::getFieldSymbol(const GameField& field, int x, int y, bool isComputer) const {
+char TerminalRenderer::getFieldSymbol(const GameField& field, int x, int y) const {
     try {
         CellStatus status = field.getCellStatus(x, y);
-        
-        if (isComputer) {
-            switch (status) {
-                case CellStatus::Unknown:
-                case CellStatus::Empty:
-                    return '.';
-                case CellStatus::Miss:
-                    return 'O';
-                case CellStatus::Ship: {
-                    Ship* ship = field.getShipAt(x, y);
-                    if (!ship) return '.';
-                    
-                    int segmentIndex = field.getSegmentIndexAt(x, y);
-                    SegmentStatus segmentStatus = ship->getSegmentStatus(segmentIndex);
-                    
-                    switch (segmentStatus) {
-                        case SegmentStatus::Intact:
-                            return '.';
-                        case SegmentStatus::Damaged:
-                            return 'D';
-                        case SegmentStatus::Destroyed:
-                            return 'X';
-                        default:
-                            return '.';
-                    }
-                }
-                default:
-                    return '.';
-            }
-        } else {
-            switch (status) {
-                case CellStatus::Unknown:
-                    return '?';
-                case CellStatus::Empty:
-                    return '.';
-                case CellStatus::Miss:
-                    return 'O';
-                case CellStatus::Ship: {
-                    Ship* ship = field.getShipAt(x, y);
-                    if (!ship) return 'S';
-                    
-                    int segmentIndex = field.getSegmentIndexAt(x, y);
-                    SegmentStatus segmentStatus = ship->getSegmentStatus(segmentIndex);
-                    
-                    switch (segmentStatus) {
-                        case SegmentStatus::Intact:
-                            return 'S';
-                        case SegmentStatus::Damaged:
-                            return 'D';
-                        case SegmentStatus::Destroyed:
-                            return 'X';
-                        default:
-                            return 'S';
-                    }
+
+        switch (status) {
+            case CellStatus::Unknown:
+                return '?';
+            case CellStatus::Empty:
+                return '.';
+            case CellStatus::Miss:
+                return 'O';
+            case CellStatus::Ship: {
+                Ship* ship = field.getShipAt(x, y);
+                if (!ship) return 'S';
+                
+                int segmentIndex = field.getSegmentIndexAt(x, y);
+                SegmentStatus segmentStatus = ship->getSegmentStatus(segmentIndex);
+                
+                switch (segmentStatus) {
+                    case SegmentStatus::Intact:
+                        return 'S';
+                    case SegmentStatus::Damaged:
+                        return 'D';
+                    case SegmentStatus::Destroyed:
+                        return 'X';
+                    default:
+                        return 'S';
                 }
-                default:
-                    return '?';
             }
+            default:
+                return '?';
         }
     } catch (const std::exception& e) {
         std::cerr << "Ошибка при получении символа поля: " << e.what() << "\n";
@@ -138,6 +113,22 @@ char TerminalRenderer::getFieldSymbol(const GameField& field, int x, int y, bool
     }
 }
 
+char TerminalRenderer::getKnowledgeSymbol(const KnowledgeBoard& knowledge, int x, int y) const {
+    switch (knowledge.at(x, y)) {
+        case Knowledge::Miss:
+            return 'O';
+        case Knowledge::Ship:
+            return 'S';
+        case Knowledge::Damaged:
+            return 'D';
+        case Knowledge::Destroyed:
+        case Knowledge::Sunk:
+            return 'X';
+        default:
+            return '.';
+    }
+}
+
 void TerminalRenderer::renderHeader() const {
     std::cout << "\n=========================\n";
     std::cout << "     МОРСКОЙ БОЙ";
@@ -3,12 +3,13 @@
 
 #include "game_display.h"
 #include "game_field.h"
+#include "knowledge_board.h"
 #include "ability_manager.h"
 
 class TerminalRenderer : public IGameRenderer {
 public:
     void renderUserField(const GameField& field) override;
-    void renderComputerField(const GameField& field) override;
+    void renderComputerField(const KnowledgeBoard& knowledge) override;
     void renderAbilityStatus(const AbilityManager& manager) override;
     void renderGameStatus(const Game& game) override;
     void renderStartMenu() override;
@@ -16,8 +17,10 @@ public:
     void renderAttackResult(int x, int y, bool isHit, bool isSunk, bool isComputerAttack);
 
 private:
-    void renderField(const GameField& field, bool isComputer) const;
-    char getFieldSymbol(const GameField& field, int x, int y, bool isComputer) const;
+    template<typename SymbolAt>
+    void renderGrid(int width, int height, SymbolAt symbolAt) const;
+    char getFieldSymbol(const GameField& field, int x, int y) const;
+    char getKnowledgeSymbol(const KnowledgeBoard& knowledge, int x, int y) const;
     void renderHeader() const;
     void renderInstructions() const;
 };
@@ -0,0 +1,74 @@
+#include "worker_pool.h"
+
+#include <algorithm>
+
+WorkerPool::WorkerPool(unsigned workers)
+{
+    workers = std::max(workers, 1u);
+    threads.reserve(workers);
+    for (unsigned worker = 0; worker < workers; ++worker)
+        threads.emplace_back(&WorkerPool::loop, this, worker);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+unsigned WorkerPool::defaultWorkers()
+{
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void WorkerPool::run(const std::function<void(unsigned worker)>& job)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    task = &job;
+    pending = size();
+    failure = nullptr;
+    ++generation;
+    wake.notify_all();
+
+    finished.wait(lock, [this] { return pending == 0; });
+    task = nullptr;
+    if (failure)
+        std::rethrow_exception(failure);
+}
+
+void WorkerPool::loop(unsigned worker)
+{
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        wake.wait(lock, [&] { return stopping || generation != seen; });
+        if (stopping)
+            return;
+
+        seen = generation;
+        const std::function<void(unsigned)>& job = *task;
+        lock.unlock();
+
+        std::exception_ptr error;
+        try
+        {
+            job(worker);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        if (error && !failure)
+            failure = error;
+        if (--pending == 0)
+            finished.notify_one();
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkerPool
+{
+public:
+    explicit WorkerPool(unsigned workers = defaultWorkers());
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    static unsigned defaultWorkers();
+
+    unsigned size() const { return static_cast<unsigned>(threads.size()); }
+    void run(const std::function<void(unsigned worker)>& job);
+
+private:
+    void loop(unsigned worker);
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    const std::function<void(unsigned)>* task = nullptr;
+    uint64_t generation = 0;
+    unsigned pending = 0;
+    bool stopping = false;
+    std::exception_ptr failure;
+};
+
+#endif